@@ -0,0 +1,74 @@
+/**
+ * @struct ColumnBatch
+ * @brief Weather readings stored as parallel column arrays.
+ *
+ * The ColumnBatch struct holds the readings produced by Parse::ParseBuffer(). Each reading is stored at the same
+ * index of the timestamp, wind speed, solar radiation and ambient temperature arrays, so a whole buffer of rows
+ * is parsed without constructing an object per row.
+ *
+ * @details The arrays are public and always have the same length, given by Size(). GetLog() builds a WeatherLog
+ * for a single row when code needs one.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 11/06/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef COLUMNBATCH_H
+#define COLUMNBATCH_H
+
+#include <vector>
+#include <cstddef>
+#include "Timestamp.h"
+#include "WeatherLog.h"
+
+struct ColumnBatch
+{
+    /**
+     * @brief Default constructor for the ColumnBatch struct.
+     */
+    ColumnBatch();
+
+    /**
+     * @brief Gets the number of rows in the batch.
+     * @return The number of rows.
+     */
+    std::size_t Size() const;
+
+    /**
+     * @brief Reserves room for a number of rows in every column.
+     * @param rows The number of rows to reserve.
+     */
+    void Reserve(std::size_t rows);
+
+    /**
+     * @brief Removes every row from the batch.
+     */
+    void Clear();
+
+    /**
+     * @brief Appends a row to the batch.
+     * @param timestamp The date and time of the reading.
+     * @param windSpeed The wind speed of the reading.
+     * @param solarRadiation The solar radiation of the reading.
+     * @param temperature The ambient temperature of the reading.
+     */
+    void Append(Timestamp timestamp, float windSpeed, float solarRadiation, float temperature);
+
+    /**
+     * @brief Builds a WeatherLog from one row of the batch.
+     * @param index The index of the row.
+     * @return The reading stored at that row.
+     */
+    WeatherLog GetLog(std::size_t index) const;
+
+    std::vector<Timestamp> timestamps; ///< Date and time of each reading.
+    std::vector<float> windSpeeds; ///< Wind speed of each reading.
+    std::vector<float> solarRadiations; ///< Solar radiation of each reading.
+    std::vector<float> temperatures; ///< Ambient temperature of each reading.
+    std::size_t invalidValues; ///< Number of empty or malformed values that were stored as 0.
+};
+
+#endif // COLUMNBATCH_H
@@ -0,0 +1,83 @@
+/**
+ * @class ColumnPlan
+ * @brief Records which columns of a weather data file hold the values that are loaded.
+ *
+ * The ColumnPlan class is compiled once from the header line of a CSV file and tells the parser at which
+ * column index the timestamp (WAST), wind speed (S), solar radiation (SR) and ambient temperature (T) are
+ * found, so that rows can be parsed without knowing the layout of the file in advance.
+ *
+ * @details A default constructed plan describes the standard logger layout "WAST,DP,Dta,Dts,EV,QFE,QFF,QNH,RF,
+ * RH,S,SR,ST1,ST2,ST3,ST4,Sx,T", which is used for files that have no header line. Compile() replaces it with
+ * the layout named by a header, so files whose columns were reordered or extended by a firmware update are still
+ * read correctly. All other columns are skipped by the parser.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 11/06/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef COLUMNPLAN_H
+#define COLUMNPLAN_H
+
+#include <string_view>
+#include <cstddef>
+
+class ColumnPlan
+{
+public:
+    static const std::size_t MaxColumns = 64; ///< Highest number of columns a plan can refer to.
+
+    /**
+     * @brief Default constructor for the ColumnPlan class.
+     * @details Initialises the plan to the standard logger layout.
+     */
+    ColumnPlan();
+
+    /**
+     * @brief Compiles the plan from the header line of a CSV file.
+     * @param header The header line, with or without its line ending.
+     * @return True if every required column was found, false otherwise. The plan is left unchanged on failure.
+     */
+    bool Compile(std::string_view header);
+
+    /**
+     * @brief Gets the column index of the date and time.
+     * @return The timestamp column index.
+     */
+    std::size_t GetTimestampColumn() const;
+
+    /**
+     * @brief Gets the column index of the wind speed.
+     * @return The wind speed column index.
+     */
+    std::size_t GetWindSpeedColumn() const;
+
+    /**
+     * @brief Gets the column index of the solar radiation.
+     * @return The solar radiation column index.
+     */
+    std::size_t GetSolarRadiationColumn() const;
+
+    /**
+     * @brief Gets the column index of the ambient temperature.
+     * @return The ambient temperature column index.
+     */
+    std::size_t GetTemperatureColumn() const;
+
+    /**
+     * @brief Gets the highest column index used by the plan. Columns after it are never read.
+     * @return The last column index.
+     */
+    std::size_t GetLastColumn() const;
+
+private:
+    std::size_t m_timestampColumn; ///< Column index of WAST.
+    std::size_t m_windSpeedColumn; ///< Column index of S.
+    std::size_t m_solarRadiationColumn; ///< Column index of SR.
+    std::size_t m_temperatureColumn; ///< Column index of T.
+    std::size_t m_lastColumn; ///< Highest of the column indexes above.
+};
+
+#endif // COLUMNPLAN_H
@@ -0,0 +1,62 @@
+#include <iostream>
+
+#include "ColumnPlan.h"
+
+void TestDefaultConstructor();
+void TestCompileStandardHeader();
+void TestCompileReorderedHeader();
+void TestCompileInvalidHeader();
+
+void PrintPlan(const ColumnPlan& plan)
+{
+    std::cout << "WAST: " << plan.GetTimestampColumn() << ", S: " << plan.GetWindSpeedColumn()
+              << ", SR: " << plan.GetSolarRadiationColumn() << ", T: " << plan.GetTemperatureColumn()
+              << ", Last: " << plan.GetLastColumn() << std::endl;
+}
+
+void TestDefaultConstructor()
+{
+    std::cout << "-- Testing Default Constructor --\n";
+    ColumnPlan plan;
+    PrintPlan(plan);
+}
+
+void TestCompileStandardHeader()
+{
+    std::cout << "-- Testing Compile() With Standard Header --\n";
+    ColumnPlan plan;
+    bool compiled = plan.Compile("WAST,DP,Dta,Dts,EV,QFE,QFF,QNH,RF,RH,S,SR,ST1,ST2,ST3,ST4,Sx,T\r\n");
+    std::cout << "Compiled: " << (compiled ? "Yes" : "No") << std::endl;
+    PrintPlan(plan);
+}
+
+void TestCompileReorderedHeader()
+{
+    std::cout << "-- Testing Compile() With Reordered Header --\n";
+    ColumnPlan plan;
+    bool compiled = plan.Compile("WAST,T,DP,SR,NEW1,S,NEW2");
+    std::cout << "Compiled: " << (compiled ? "Yes" : "No") << std::endl;
+    PrintPlan(plan);
+}
+
+void TestCompileInvalidHeader()
+{
+    std::cout << "-- Testing Compile() With Data Line --\n";
+    ColumnPlan plan;
+    bool compiled = plan.Compile("1/3/2014 9:00,1,2,3,4,5,6,7,8,9,14,587,1,2,3,4,5,21.4");
+    std::cout << "Compiled: " << (compiled ? "Yes" : "No") << std::endl;
+    PrintPlan(plan);
+}
+
+int main()
+{
+    TestDefaultConstructor();
+    std::cout << std::endl;
+    TestCompileStandardHeader();
+    std::cout << std::endl;
+    TestCompileReorderedHeader();
+    std::cout << std::endl;
+    TestCompileInvalidHeader();
+
+    return 0;
+}
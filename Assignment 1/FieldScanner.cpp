@@ -0,0 +1,111 @@
+#include "FieldScanner.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define FIELDSCANNER_X86 1
+#endif
+
+namespace
+{
+    typedef std::size_t (*ScanKernel)(const char*, std::size_t, std::uint32_t*, std::size_t);
+
+    std::size_t ScanTail(const char* data, std::size_t begin, std::size_t size, std::uint32_t* positions, std::size_t count, std::size_t capacity)
+    {
+        for (std::size_t i = begin; i < size && count < capacity; i++)
+        {
+            if (data[i] == ',' || data[i] == '\n')
+            {
+                positions[count++] = static_cast<std::uint32_t>(i);
+            }
+        }
+        return count;
+    }
+
+#ifdef FIELDSCANNER_X86
+    // Appends the offset of every set bit of mask, relative to base, until positions is full.
+    inline std::size_t EmitMask(std::uint32_t mask, std::size_t base, std::uint32_t* positions, std::size_t count, std::size_t capacity)
+    {
+        while (mask != 0 && count < capacity)
+        {
+            positions[count++] = static_cast<std::uint32_t>(base + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+        return count;
+    }
+
+    __attribute__((target("sse2")))
+    std::size_t ScanSSE2(const char* data, std::size_t size, std::uint32_t* positions, std::size_t capacity)
+    {
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i newline = _mm_set1_epi8('\n');
+        std::size_t count = 0;
+        std::size_t i = 0;
+
+        for (; i + 16 <= size && count < capacity; i += 16)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(block, comma), _mm_cmpeq_epi8(block, newline));
+            count = EmitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(matches)), i, positions, count, capacity);
+        }
+
+        return ScanTail(data, i, size, positions, count, capacity);
+    }
+
+    __attribute__((target("avx2")))
+    std::size_t ScanAVX2(const char* data, std::size_t size, std::uint32_t* positions, std::size_t capacity)
+    {
+        const __m256i comma = _mm256_set1_epi8(',');
+        const __m256i newline = _mm256_set1_epi8('\n');
+        std::size_t count = 0;
+        std::size_t i = 0;
+
+        for (; i + 32 <= size && count < capacity; i += 32)
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i matches = _mm256_or_si256(_mm256_cmpeq_epi8(block, comma), _mm256_cmpeq_epi8(block, newline));
+            count = EmitMask(static_cast<std::uint32_t>(_mm256_movemask_epi8(matches)), i, positions, count, capacity);
+        }
+
+        return ScanTail(data, i, size, positions, count, capacity);
+    }
+#endif
+
+    struct Kernel
+    {
+        ScanKernel scan; // Widest kernel supported by the CPU.
+        const char* name; // Name reported by KernelName().
+    };
+
+    Kernel SelectKernel()
+    {
+#ifdef FIELDSCANNER_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return Kernel{ScanAVX2, "AVX2"};
+        if (__builtin_cpu_supports("sse2"))
+            return Kernel{ScanSSE2, "SSE2"};
+#endif
+        return Kernel{FieldScanner::FindDelimitersScalar, "Scalar"};
+    }
+
+    const Kernel& SelectedKernel()
+    {
+        static const Kernel kernel = SelectKernel();
+        return kernel;
+    }
+}
+
+std::size_t FieldScanner::FindDelimiters(const char* data, std::size_t size, std::uint32_t* positions, std::size_t capacity)
+{
+    return SelectedKernel().scan(data, size, positions, capacity);
+}
+
+std::size_t FieldScanner::FindDelimitersScalar(const char* data, std::size_t size, std::uint32_t* positions, std::size_t capacity)
+{
+    return ScanTail(data, 0, size, positions, 0, capacity);
+}
+
+const char* FieldScanner::KernelName()
+{
+    return SelectedKernel().name;
+}
@@ -0,0 +1,56 @@
+/**
+ * @class FieldScanner
+ * @brief Locates the field delimiters of CSV data in bulk.
+ *
+ * The FieldScanner class finds the positions of every comma and newline in a block of bytes in a single
+ * pass, so that a parser can jump straight to the fields it needs instead of reading every field in turn.
+ *
+ * @details The scan compares 32 (AVX2) or 16 (SSE2) bytes per step and turns the matches into a bit mask,
+ * from which the delimiter positions are extracted. The widest kernel supported by the CPU is selected once
+ * at run time. A scalar kernel is used on other architectures and for the bytes left over after the last
+ * full vector. All kernels produce identical results.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 11/06/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef FIELDSCANNER_H
+#define FIELDSCANNER_H
+
+#include <cstddef>
+#include <cstdint>
+
+class FieldScanner
+{
+public:
+    /**
+     * @brief Finds the positions of the commas and newlines in a block of bytes.
+     * @param data Pointer to the first byte of the block.
+     * @param size The number of bytes in the block.
+     * @param positions Array receiving the offsets of the delimiters from data, in increasing order.
+     * @param capacity The number of entries available in positions. Scanning stops once it is full.
+     * @return The number of delimiter offsets written to positions.
+     */
+    static std::size_t FindDelimiters(const char* data, std::size_t size, std::uint32_t* positions, std::size_t capacity);
+
+    /**
+     * @brief Scalar version of FindDelimiters(), used as the fallback kernel.
+     * @param data Pointer to the first byte of the block.
+     * @param size The number of bytes in the block.
+     * @param positions Array receiving the offsets of the delimiters from data, in increasing order.
+     * @param capacity The number of entries available in positions. Scanning stops once it is full.
+     * @return The number of delimiter offsets written to positions.
+     */
+    static std::size_t FindDelimitersScalar(const char* data, std::size_t size, std::uint32_t* positions, std::size_t capacity);
+
+    /**
+     * @brief Gets the name of the kernel selected by FindDelimiters() on this CPU.
+     * @return "AVX2", "SSE2" or "Scalar".
+     */
+    static const char* KernelName();
+};
+
+#endif // FIELDSCANNER_H
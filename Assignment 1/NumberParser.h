@@ -0,0 +1,71 @@
+/**
+ * @class NumberParser
+ * @brief Converts text fields to numbers without allocating memory.
+ *
+ * The NumberParser class converts the numeric fields of the weather data files, given as string views, to
+ * integer and floating-point values. It replaces the std::stringstream based conversion, which needed several
+ * heap allocations and locale lookups for every field.
+ *
+ * @details The conversions use std::from_chars and are locale independent. Surrounding blanks and a leading '+'
+ * are accepted, anything else around the number makes the field malformed. Every conversion reports whether it
+ * succeeded, and on failure the output is set to zero so that no caller ever reads an uninitialised value.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 11/06/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef NUMBERPARSER_H
+#define NUMBERPARSER_H
+
+#include <string_view>
+
+class NumberParser
+{
+public:
+    /**
+     * @brief Outcome of a conversion.
+     */
+    enum class Result
+    {
+        Ok, ///< The whole field was a valid number.
+        Empty, ///< The field was empty or blank.
+        Malformed, ///< The field was not a number of the requested type.
+        OutOfRange ///< The number does not fit in the requested type.
+    };
+
+    /**
+     * @brief Converts a field to an integer.
+     * @param text The field to convert.
+     * @param value Receives the converted value, or 0 if the conversion failed.
+     * @return The outcome of the conversion.
+     */
+    static Result ToInt(std::string_view text, int& value);
+
+    /**
+     * @brief Converts a field to an unsigned integer.
+     * @param text The field to convert.
+     * @param value Receives the converted value, or 0 if the conversion failed.
+     * @return The outcome of the conversion.
+     */
+    static Result ToUnsigned(std::string_view text, unsigned int& value);
+
+    /**
+     * @brief Converts a field to a floating-point number.
+     * @param text The field to convert.
+     * @param value Receives the converted value, or 0 if the conversion failed.
+     * @return The outcome of the conversion.
+     */
+    static Result ToFloat(std::string_view text, float& value);
+
+    /**
+     * @brief Converts a conversion outcome to a readable string.
+     * @param result The outcome to convert.
+     * @return The name of the outcome.
+     */
+    static const char* ResultToString(Result result);
+};
+
+#endif // NUMBERPARSER_H
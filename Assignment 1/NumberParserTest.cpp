@@ -0,0 +1,69 @@
+#include <iostream>
+
+#include "NumberParser.h"
+
+void TestToInt();
+void TestToUnsigned();
+void TestToFloat();
+void TestInvalidFields();
+
+void TestToInt()
+{
+    std::cout << "-- Testing ToInt() --\n";
+    const char* fields[] = {"14", "-3", "+7", " 12\r", ""};
+    for (const char* field : fields)
+    {
+        int value;
+        NumberParser::Result result = NumberParser::ToInt(field, value);
+        std::cout << "\"" << field << "\": " << NumberParser::ResultToString(result) << ", " << value << std::endl;
+    }
+}
+
+void TestToUnsigned()
+{
+    std::cout << "-- Testing ToUnsigned() --\n";
+    const char* fields[] = {"2014", "-1", "99999999999"};
+    for (const char* field : fields)
+    {
+        unsigned int value;
+        NumberParser::Result result = NumberParser::ToUnsigned(field, value);
+        std::cout << "\"" << field << "\": " << NumberParser::ResultToString(result) << ", " << value << std::endl;
+    }
+}
+
+void TestToFloat()
+{
+    std::cout << "-- Testing ToFloat() --\n";
+    const char* fields[] = {"21.4", "-0.5", "587", "1e3"};
+    for (const char* field : fields)
+    {
+        float value;
+        NumberParser::Result result = NumberParser::ToFloat(field, value);
+        std::cout << "\"" << field << "\": " << NumberParser::ResultToString(result) << ", " << value << std::endl;
+    }
+}
+
+void TestInvalidFields()
+{
+    std::cout << "-- Testing Empty And Malformed Fields --\n";
+    const char* fields[] = {"", "   ", "N/A", "12abc", "+"};
+    for (const char* field : fields)
+    {
+        float value = 99.0f;
+        NumberParser::Result result = NumberParser::ToFloat(field, value);
+        std::cout << "\"" << field << "\": " << NumberParser::ResultToString(result) << ", " << value << std::endl;
+    }
+}
+
+int main()
+{
+    TestToInt();
+    std::cout << std::endl;
+    TestToUnsigned();
+    std::cout << std::endl;
+    TestToFloat();
+    std::cout << std::endl;
+    TestInvalidFields();
+
+    return 0;
+}
@@ -1,130 +1,185 @@
 /**
  * @class Parse
- * @brief
+ * @brief Parses weather log data and extracts relevant information.
  *
+ * The Parse class is responsible for parsing weather log data and extracting
+ * relevant information such as date, time, wind speed, solar radiation, and ambient temperature.
+ * It provides functions to convert strings to integer and floating-point numbers, which are implemented by NumberParser
+ * and report empty or malformed fields instead of returning an undefined value.
  *
+ * @note The columns are located through a ColumnPlan, which defaults to the standard logger layout and can be
+ * compiled from the header line of each file with ReadHeader().
  *
+ * @details ParseBuffer() is the ingestion path for whole files or byte ranges of them. It parses every line of a
+ * buffer into the parallel arrays of a ColumnBatch in one call, without constructing an object per row. ParseLog()
+ * parses a single line into the parser, whose components are then read back with the getter functions.
  *
  * @author Mohsin Ali Khan
- * @version 02
+ * @version 03
  * @date 11/06/2023
  *
- * @bug No known bugs to the best of my knowledge
+ * @bug No known bugs to the best of my knowledge.
  */
 
 #ifndef PARSE_H
 #define PARSE_H
 
 #include <string>
-#include <iostream>
-#include <sstream>
+#include <string_view>
+#include "Date.h"
+#include "Time.h"
+#include "ColumnPlan.h"
+#include "ColumnBatch.h"
+#include "NumberParser.h"
 
-/**
- * @class Parse
- * @brief A class for parsing log data.
- */
 class Parse
 {
 public:
     /**
-     * @brief Default constructor for Parse.
+     * @brief Default constructor for the Parse class.
      */
     Parse();
 
     /**
-     * @brief Destructor for Parse.
+     * @brief Destructor for the Parse class.
      */
     ~Parse();
 
     /**
-     * @brief Parses a log line.
-     * @param line The log line to parse.
+     * @brief Compiles the column plan of a buffer from its first line, if that line is a header.
+     * @param bytes The contents of a weather data file.
+     * @param plan Receives the layout named by the header. It is left unchanged if the buffer has no header.
+     * @return The bytes following the header line, or all of bytes if there is no header.
+     */
+    static std::string_view ReadHeader(std::string_view bytes, ColumnPlan& plan);
+
+    /**
+     * @brief Parses every line of a buffer and appends the readings to a batch.
+     * @details The delimiters of each line are located in one vectorised pass by FieldScanner, after which only the
+     * date/time, wind speed, solar radiation and ambient temperature columns named by the plan are read. Fields are
+     * read as views into the buffer. Lines whose date or time cannot be parsed are skipped.
+     * @param bytes The lines to parse, without a header line.
+     * @param plan The column layout of the lines.
+     * @param batch The batch the readings are appended to.
+     * @return The number of readings appended to the batch.
+     */
+    static std::size_t ParseBuffer(std::string_view bytes, const ColumnPlan& plan, ColumnBatch& batch);
+
+    /**
+     * @brief Parses a single line of weather log data.
+     * @param line The line of weather log data to parse, without its trailing newline.
+     * @return True if the date and time of the line were parsed, false for malformed lines such as the CSV header.
      */
-    void ParseLog(std::string line);
+    bool ParseLog(std::string_view line);
 
     /**
-     * @brief Parses a date string.
-     * @param date The date string to parse.
+     * @brief Sets the column plan used to locate the fields of each line.
+     * @param columnPlan The plan compiled from the header of the file being parsed.
      */
-    void ParseDate(std::string date);
+    void SetColumnPlan(const ColumnPlan& columnPlan);
 
     /**
-     * @brief Parses a time string.
-     * @param time The time string to parse.
+     * @brief Gets the column plan used to locate the fields of each line.
+     * @return The current column plan.
      */
-    void ParseTime(std::string time);
+    const ColumnPlan& GetColumnPlan() const;
+
+    /**
+     * @brief Parses a date string of the form "dd/mm/yyyy" and sets the date components.
+     * @param date The date string to be parsed.
+     * @return True if the day, month and year were all valid numbers, false otherwise.
+     */
+    bool ParseDate(std::string_view date);
+
+    /**
+     * @brief Parses a time string of the form "hh:mm" and sets the time components.
+     * @param time The time string to be parsed.
+     * @return True if the hour and minutes were both valid numbers, false otherwise.
+     */
+    bool ParseTime(std::string_view time);
 
     /**
      * @brief Converts a string to an integer.
-     * @param line The string to convert.
-     * @return The converted integer value.
+     * @param line The string to be converted.
+     * @param value Receives the integer value of the string, or 0 if the string is empty or malformed.
+     * @return The outcome of the conversion.
+     */
+    NumberParser::Result StringToInt(std::string_view line, int& value);
+
+    /**
+     * @brief Converts a string to a floating-point number.
+     * @param line The string to be converted.
+     * @param value Receives the floating-point value of the string, or 0 if the string is empty or malformed.
+     * @return The outcome of the conversion.
      */
-    int StringToInt(std::string line);
+    NumberParser::Result StringToFloat(std::string_view line, float& value);
 
     /**
-     * @brief Converts a string to a float.
-     * @param line The string to convert.
-     * @return The converted float value.
+     * @brief Gets the number of wind speed, solar radiation and ambient temperature fields of the last parsed
+     * line that were empty or malformed and therefore set to 0.
+     * @return The number of invalid fields in the last parsed line.
      */
-    float StringToFloat(std::string line);
+    unsigned int GetInvalidFieldCount() const;
 
     /**
-     * @brief Gets the parsed day.
-     * @return The parsed day.
+     * @brief Gets the parsed day value.
+     * @return The parsed day value.
      */
     unsigned int GetParseDay();
 
     /**
-     * @brief Gets the parsed month.
-     * @return The parsed month.
+     * @brief Gets the parsed month value.
+     * @return The parsed month value.
      */
     unsigned int GetParseMonth();
 
     /**
-     * @brief Gets the parsed year.
-     * @return The parsed year.
+     * @brief Gets the parsed year value.
+     * @return The parsed year value.
      */
     unsigned int GetParseYear();
 
     /**
-     * @brief Gets the parsed hour.
-     * @return The parsed hour.
+     * @brief Gets the parsed hour value.
+     * @return The parsed hour value.
      */
     unsigned int GetParseHour();
 
     /**
-     * @brief Gets the parsed minutes.
-     * @return The parsed minutes.
+     * @brief Gets the parsed minutes value.
+     * @return The parsed minutes value.
      */
     unsigned int GetParseMinutes();
 
     /**
-     * @brief Gets the parsed wind speed.
-     * @return The parsed wind speed.
+     * @brief Gets the parsed wind speed value.
+     * @return The parsed wind speed value.
      */
     int GetParseWS();
 
     /**
-     * @brief Gets the parsed solar radiation.
-     * @return The parsed solar radiation.
+     * @brief Gets the parsed solar radiation value.
+     * @return The parsed solar radiation value.
      */
     float GetParseSR();
 
     /**
-     * @brief Gets the parsed ambient temperature.
-     * @return The parsed ambient temperature.
+     * @brief Gets the parsed ambient temperature value.
+     * @return The parsed ambient temperature value.
      */
     float GetParseAT();
 
 private:
-    unsigned int day;     ///< Parsed day.
-    unsigned int month;   ///< Parsed month.
-    unsigned int year;    ///< Parsed year.
-    unsigned int hour;    ///< Parsed hour.
-    unsigned int minutes; ///< Parsed minutes.
-    int windS;            ///< Parsed wind speed.
-    float solarR;         ///< Parsed solar radiation.
-    float ambientT;       ///< Parsed ambient temperature.
+    unsigned int day; ///< Parsed day value.
+    unsigned int month; ///< Parsed month value.
+    unsigned int year; ///< Parsed year value.
+    unsigned int hour; ///< Parsed hour value.
+    unsigned int minutes; ///< Parsed minutes value.
+    int windS; ///< Parsed wind speed value.
+    float solarR; ///< Parsed solar radiation value.
+    float ambientT; ///< Parsed ambient temperature value.
+    unsigned int invalidFields; ///< Number of empty or malformed values in the last parsed line.
+    ColumnPlan plan; ///< Column layout of the lines being parsed.
 };
 
 #endif // PARSE_H
@@ -0,0 +1,228 @@
+/**
+ * @class RunningStats
+ * @brief Single-pass accumulator for the count, mean, variance, minimum and maximum of a series of values.
+ *
+ * The RunningStats class takes values one at a time and keeps just enough state to report their mean and
+ * variance at any point, so that the statistics of a month of readings come from a single pass over the
+ * readings instead of one pass for the mean and another for the variance.
+ *
+ * @details The mean and the sum of squared deviations from the mean (M2) are updated with Welford's method,
+ * which avoids the cancellation of the textbook sum-of-squares formula. Add() also accepts a value with a
+ * repeat count, and AddRange() accepts any input iterator range, such as a pointer range over the elements of
+ * a Vector. All arithmetic is done in double.
+ *
+ * Merge() combines two accumulators with the pairwise update of Chan et al., giving the same statistics as
+ * adding every value to one accumulator. Partial results computed separately, for example per thread or per
+ * month, can therefore be combined exactly in any order.
+ *
+ * @note The mean, variances, minimum and maximum of an empty accumulator are 0. The sample variance of a
+ * single value is 0.
+ *
+ * @author Mohsin Ali Khan
+ * @version 02
+ * @date 11/06/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef RUNNINGSTATS_H
+#define RUNNINGSTATS_H
+
+#include <cmath>
+#include <cstddef>
+
+class RunningStats
+{
+public:
+    /**
+     * @brief Default constructor for the RunningStats class. Creates an empty accumulator.
+     */
+    RunningStats() : m_count(0), m_mean(0.0), m_m2(0.0), m_min(0.0), m_max(0.0)
+    {
+    }
+
+    /**
+     * @brief Adds one value.
+     * @param value The value to be added.
+     */
+    void Add(double value)
+    {
+        UpdateRange(value);
+        m_count++;
+        double delta = value - m_mean;
+        m_mean += delta / static_cast<double>(m_count);
+        m_m2 += delta * (value - m_mean);
+    }
+
+    /**
+     * @brief Adds a value that occurs several times, in one step.
+     * @param value The value to be added.
+     * @param count The number of times the value occurs. Nothing is added if it is 0.
+     */
+    void Add(double value, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        UpdateRange(value);
+        double previous = static_cast<double>(m_count);
+        double weight = static_cast<double>(count);
+        m_count += count;
+        double delta = value - m_mean;
+        double total = static_cast<double>(m_count);
+        m_mean += delta * weight / total;
+        m_m2 += delta * delta * previous * weight / total;
+    }
+
+    /**
+     * @brief Adds every value added to another accumulator.
+     * @param other The accumulator to be merged into this one.
+     */
+    void Merge(const RunningStats& other)
+    {
+        if (other.m_count == 0)
+            return;
+        if (m_count == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        double count = static_cast<double>(m_count);
+        double otherCount = static_cast<double>(other.m_count);
+        double total = count + otherCount;
+        double delta = other.m_mean - m_mean;
+        m_mean += delta * otherCount / total;
+        m_m2 += other.m_m2 + delta * delta * count * otherCount / total;
+        m_count += other.m_count;
+        if (other.m_min < m_min)
+            m_min = other.m_min;
+        if (other.m_max > m_max)
+            m_max = other.m_max;
+    }
+
+    /**
+     * @brief Adds every value of an iterator range.
+     * @param begin Iterator to the first value.
+     * @param end Iterator past the last value.
+     */
+    template <class InputIterator>
+    void AddRange(InputIterator begin, InputIterator end)
+    {
+        for (InputIterator current = begin; current != end; ++current)
+        {
+            Add(static_cast<double>(*current));
+        }
+    }
+
+    /**
+     * @brief Gets the number of values added.
+     * @return The count of values.
+     */
+    std::size_t Count() const
+    {
+        return m_count;
+    }
+
+    /**
+     * @brief Gets the sum of the values added.
+     * @return The sum of the values.
+     */
+    double Sum() const
+    {
+        return m_mean * static_cast<double>(m_count);
+    }
+
+    /**
+     * @brief Gets the arithmetic mean of the values added.
+     * @return The mean of the values.
+     */
+    double Mean() const
+    {
+        return m_mean;
+    }
+
+    /**
+     * @brief Gets the sum of the squared deviations of the values from their mean.
+     * @return The M2 term of Welford's method.
+     */
+    double SumOfSquaredDeviations() const
+    {
+        return m_m2;
+    }
+
+    /**
+     * @brief Gets the population variance of the values, dividing by the count.
+     * @return The population variance.
+     */
+    double PopulationVariance() const
+    {
+        return m_count == 0 ? 0.0 : m_m2 / static_cast<double>(m_count);
+    }
+
+    /**
+     * @brief Gets the sample variance of the values, dividing by the count minus one.
+     * @return The sample variance.
+     */
+    double SampleVariance() const
+    {
+        return m_count < 2 ? 0.0 : m_m2 / static_cast<double>(m_count - 1);
+    }
+
+    /**
+     * @brief Gets the population standard deviation of the values.
+     * @return The square root of the population variance.
+     */
+    double PopulationStandardDeviation() const
+    {
+        return std::sqrt(PopulationVariance());
+    }
+
+    /**
+     * @brief Gets the sample standard deviation of the values.
+     * @return The square root of the sample variance.
+     */
+    double SampleStandardDeviation() const
+    {
+        return std::sqrt(SampleVariance());
+    }
+
+    /**
+     * @brief Gets the smallest value added.
+     * @return The minimum value.
+     */
+    double Min() const
+    {
+        return m_min;
+    }
+
+    /**
+     * @brief Gets the largest value added.
+     * @return The maximum value.
+     */
+    double Max() const
+    {
+        return m_max;
+    }
+
+private:
+    /**
+     * @brief Widens the minimum and maximum to include a value. Called before the count includes it.
+     * @param value The value being added.
+     */
+    void UpdateRange(double value)
+    {
+        if (m_count == 0 || value < m_min)
+            m_min = value;
+        if (m_count == 0 || value > m_max)
+            m_max = value;
+    }
+
+    std::size_t m_count; ///< Number of values added.
+    double m_mean; ///< Running mean of the values.
+    double m_m2; ///< Running sum of squared deviations from the mean.
+    double m_min; ///< Smallest value added.
+    double m_max; ///< Largest value added.
+};
+
+#endif // RUNNINGSTATS_H
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <cmath>
+
+#include "RunningStats.h"
+#include "Vector.h"
+
+void TestEmpty();
+void TestMeanAndVariance();
+void TestRepeatedValues();
+void TestVector();
+void TestLargeOffset();
+void TestMerge();
+
+void TestEmpty()
+{
+    std::cout << "-- Testing Empty Accumulator --\n";
+    RunningStats stats;
+    std::cout << "Count: " << stats.Count() << ", Mean: " << stats.Mean() << ", Sample Variance: " << stats.SampleVariance() << std::endl;
+    stats.Add(4.0);
+    std::cout << "One value, Population Variance: " << stats.PopulationVariance() << ", Sample Variance: " << stats.SampleVariance() << std::endl;
+}
+
+void TestMeanAndVariance()
+{
+    std::cout << "-- Testing Mean, Variance, Min and Max --\n";
+    double values[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    RunningStats stats;
+    for (double value : values)
+    {
+        stats.Add(value);
+    }
+    std::cout << "Count: " << stats.Count() << ", Sum: " << stats.Sum() << ", Mean: " << stats.Mean() << " (expected 5)" << std::endl;
+    std::cout << "Population Std Dev: " << stats.PopulationStandardDeviation() << " (expected 2)" << std::endl;
+    std::cout << "Sample Variance: " << stats.SampleVariance() << " (expected " << 32.0 / 7.0 << ")" << std::endl;
+    std::cout << "Min: " << stats.Min() << ", Max: " << stats.Max() << std::endl;
+}
+
+void TestRepeatedValues()
+{
+    std::cout << "-- Testing Add() With a Count --\n";
+    RunningStats single;
+    RunningStats counted;
+    double values[] = {7.5, -3.0, 12.25, 7.5};
+    std::size_t counts[] = {3, 1, 4, 2};
+    for (int i = 0; i < 4; i++)
+    {
+        for (std::size_t j = 0; j < counts[i]; j++)
+        {
+            single.Add(values[i]);
+        }
+        counted.Add(values[i], counts[i]);
+    }
+    counted.Add(100.0, 0);
+    std::cout << "Counts: " << single.Count() << " and " << counted.Count() << std::endl;
+    std::cout << "Means match: " << (std::fabs(single.Mean() - counted.Mean()) < 1e-12 ? "Yes" : "No") << std::endl;
+    std::cout << "Variances match: " << (std::fabs(single.SampleVariance() - counted.SampleVariance()) < 1e-12 ? "Yes" : "No") << std::endl;
+    std::cout << "Min: " << counted.Min() << ", Max: " << counted.Max() << std::endl;
+}
+
+void TestVector()
+{
+    std::cout << "-- Testing AddRange() on a Vector --\n";
+    Vector<float> column;
+    float values[] = {3.5f, 1.0f, 3.5f, 8.0f, 1.0f, 3.5f};
+    for (float value : values)
+    {
+        column.PushBack(value);
+    }
+    RunningStats stats;
+    stats.AddRange(&column[0], &column[0] + column.Size());
+    std::cout << "Vector: " << stats.Count() << " values, mean " << stats.Mean() << ", sample std dev " << stats.SampleStandardDeviation() << std::endl;
+}
+
+void TestLargeOffset()
+{
+    std::cout << "-- Testing Values With a Large Common Offset --\n";
+    // The textbook sum-of-squares formula loses every digit of this variance to cancellation.
+    RunningStats stats;
+    for (int i = 0; i < 1000; i++)
+    {
+        stats.Add(1e9 + (i % 2 == 0 ? 1.0 : -1.0));
+    }
+    std::cout << "Population Variance: " << stats.PopulationVariance() << " (expected 1)" << std::endl;
+}
+
+void TestMerge()
+{
+    std::cout << "-- Testing Merge() --\n";
+    RunningStats all;
+    RunningStats first;
+    RunningStats second;
+    RunningStats empty;
+    for (int i = 0; i < 500; i++)
+    {
+        double value = 100.0 + std::sin(i * 0.01) * 30.0 + i % 11;
+        all.Add(value);
+        (i < 120 ? first : second).Add(value);
+    }
+    RunningStats merged = empty;
+    merged.Merge(first);
+    merged.Merge(empty);
+    merged.Merge(second);
+    std::cout << "Count: " << merged.Count() << std::endl;
+    std::cout << "Mean matches: " << (std::fabs(all.Mean() - merged.Mean()) < 1e-9 ? "Yes" : "No") << std::endl;
+    std::cout << "Sample variance matches: " << (std::fabs(all.SampleVariance() - merged.SampleVariance()) < 1e-9 ? "Yes" : "No") << std::endl;
+    std::cout << "Min and max match: " << (all.Min() == merged.Min() && all.Max() == merged.Max() ? "Yes" : "No") << std::endl;
+}
+
+int main()
+{
+    TestEmpty();
+    std::cout << std::endl;
+    TestMeanAndVariance();
+    std::cout << std::endl;
+    TestRepeatedValues();
+    std::cout << std::endl;
+    TestVector();
+    std::cout << std::endl;
+    TestLargeOffset();
+    std::cout << std::endl;
+    TestMerge();
+
+    return 0;
+}
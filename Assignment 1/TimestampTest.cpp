@@ -0,0 +1,62 @@
+#include <iostream>
+
+#include "Timestamp.h"
+
+void TestEncodeDecode();
+void TestFromDateTime();
+void TestOrdering();
+void TestDistinctKeys();
+
+// Encoding is constexpr, so the layout can be checked at compile time.
+static_assert(Timestamp::Encode(2014, 3, 1, 9, 30).GetYear() == 2014, "year round trip");
+static_assert(Timestamp::Encode(2014, 3, 1, 9, 30).GetMinute() == 30, "minute round trip");
+static_assert(Timestamp::Encode(2014, 12, 31, 23, 50) < Timestamp::Encode(2015, 1, 1, 0, 0), "year boundary order");
+
+void TestEncodeDecode()
+{
+    std::cout << "-- Testing Encode() And Decode --\n";
+    Timestamp timestamp = Timestamp::Encode(2014, 3, 1, 9, 30);
+    std::cout << "Value: " << timestamp.GetValue() << std::endl;
+    std::cout << "Decoded: " << timestamp.GetDay() << "/" << timestamp.GetMonth() << "/" << timestamp.GetYear()
+              << " " << timestamp.GetHour() << ":" << timestamp.GetMinute() << std::endl;
+}
+
+void TestFromDateTime()
+{
+    std::cout << "-- Testing FromDateTime() --\n";
+    Timestamp timestamp = Timestamp::FromDateTime(Date(20, 11, 2023), Time(14, 5));
+    std::cout << "Date: " << timestamp.GetDate().DateToString() << std::endl;
+    std::cout << "Time: " << timestamp.GetTime().TimeToString() << std::endl;
+}
+
+void TestOrdering()
+{
+    std::cout << "-- Testing Ordering --\n";
+    Timestamp morning = Timestamp::Encode(2014, 3, 1, 9, 30);
+    Timestamp evening = Timestamp::Encode(2014, 3, 1, 21, 0);
+    Timestamp nextMonth = Timestamp::Encode(2014, 4, 1, 0, 0);
+    std::cout << "Morning < Evening: " << (morning < evening ? "Yes" : "No") << std::endl;
+    std::cout << "Evening < Next Month: " << (evening < nextMonth ? "Yes" : "No") << std::endl;
+    std::cout << "Morning == Morning: " << (morning == Timestamp::Encode(2014, 3, 1, 9, 30) ? "Yes" : "No") << std::endl;
+}
+
+void TestDistinctKeys()
+{
+    std::cout << "-- Testing Distinct Keys --\n";
+    Timestamp january = Timestamp::Encode(2014, 1, 11, 0, 0);
+    Timestamp november = Timestamp::Encode(2014, 11, 1, 0, 0);
+    std::cout << "11/1/2014 and 1/11/2014 distinct: " << (january != november ? "Yes" : "No") << std::endl;
+}
+
+int main()
+{
+    TestEncodeDecode();
+    std::cout << std::endl;
+    TestFromDateTime();
+    std::cout << std::endl;
+    TestOrdering();
+    std::cout << std::endl;
+    TestDistinctKeys();
+
+    return 0;
+}
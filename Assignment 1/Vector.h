@@ -1,12 +1,18 @@
 /**
  * @class Vector
- * @brief
- *
+ * @brief A dynamic array that grows as elements are added.
  *
+ * Vectors can be moved as well as copied: moving hands the storage of one vector to another in O(1) and leaves
+ * the source empty. EmplaceBack() builds a new element from constructor arguments, and growing the storage moves
+ * the existing elements instead of copying them.
  *
+ * @details The storage is a raw block: only the first Size() slots hold constructed elements, and new elements
+ * are constructed in place. When T is trivially copyable, growing uses realloc() and shifting uses memmove(), so
+ * no element is constructed or copied one at a time. The capacity is multiplied by GrowthFactor() whenever the
+ * vector is full, which is 2 unless SetGrowthFactor() changes it.
  *
  * @author Mohsin Ali Khan
- * @version 02
+ * @version 04
  * @date 11/06/2023
  *
  * @bug No known bugs to the best of my knowledge
@@ -15,7 +21,14 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 template <typename T>
 class Vector
@@ -24,6 +37,9 @@ private:
     T* m_data;           /**< Pointer to the dynamic array */
     size_t m_size;       /**< Number of elements in the vector */
     size_t m_capacity;   /**< Capacity of the vector */
+    double m_growthFactor; /**< Factor by which the capacity grows when the vector is full */
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Vector storage is only aligned for fundamental types");
 
 public:
     /**
@@ -57,6 +73,19 @@ public:
      */
     Vector& operator=(const Vector& other);
 
+    /**
+     * @brief Move constructor for the Vector class.
+     * @param other The vector whose storage is taken over. It is left empty.
+     */
+    Vector(Vector&& other) noexcept;
+
+    /**
+     * @brief Move assignment operator for the Vector class.
+     * @param other The vector whose storage is taken over. It is left empty.
+     * @return Reference to the assigned vector.
+     */
+    Vector& operator=(Vector&& other) noexcept;
+
     /**
      * @brief Destructor for the Vector class.
      */
@@ -93,6 +122,19 @@ public:
      */
     void PushBack(const T& value);
 
+    /**
+     * @brief Adds an element to the end of the vector by moving it.
+     * @param value The value to be moved into the vector.
+     */
+    void PushBack(T&& value);
+
+    /**
+     * @brief Adds an element built from constructor arguments to the end of the vector.
+     * @param args The arguments passed to the constructor of T.
+     */
+    template <typename... Args>
+    void EmplaceBack(Args&&... args);
+
     /**
      * @brief Removes the last element from the vector.
      */
@@ -105,6 +147,13 @@ public:
      */
     void Insert(const T& value, size_t position);
 
+    /**
+     * @brief Inserts an element at the specified position by moving it.
+     * @param value The value to be moved into the vector.
+     * @param position The position at which the value should be inserted.
+     */
+    void Insert(T&& value, size_t position);
+
     /**
      * @brief Removes an element at the specified position.
      * @param position The position of the element to be removed.
@@ -128,39 +177,91 @@ public:
      */
     void Reserve(size_t newCapacity);
 
+    /**
+     * @brief Returns the factor by which the capacity grows when the vector is full.
+     * @return The growth factor of the vector.
+     */
+    double GrowthFactor() const;
+
+    /**
+     * @brief Sets the factor by which the capacity grows when the vector is full.
+     * @param factor The new growth factor, which must be greater than 1.
+     */
+    void SetGrowthFactor(double factor);
+
 private:
     /**
-     * @brief Copies the elements from the source vector to the destination vector.
+     * @brief True when elements can be relocated with memcpy() and memmove().
+     */
+    static constexpr bool IsTrivial = std::is_trivially_copyable<T>::value;
+
+    /**
+     * @brief Allocates an uninitialised block of storage.
+     * @param capacity The number of elements the block must hold.
+     * @return Pointer to the block, or nullptr if capacity is 0.
+     */
+    static T* Allocate(size_t capacity);
+
+    /**
+     * @brief Destroys the elements in a range of positions, leaving their slots uninitialised.
+     * @param first The first position to destroy.
+     * @param last One past the last position to destroy.
+     */
+    void DestroyElements(size_t first, size_t last);
+
+    /**
+     * @brief Copy-constructs the elements of the source vector into the uninitialised storage of this vector.
      * @param source The source vector.
-     * @param destination The destination vector.
      */
-    void CopyElements(const Vector& source, Vector& destination);
+    void CopyElements(const Vector& source);
+
+    /**
+     * @brief Move-constructs the elements of this vector into an uninitialised block and destroys the originals.
+     * @param destination The block receiving the elements.
+     */
+    void MoveElements(T* destination);
+
+    /**
+     * @brief Returns the capacity to grow to when the vector is full.
+     * @return The current capacity times the growth factor, and at least one more than the current capacity.
+     */
+    size_t NextCapacity() const;
+
+    /**
+     * @brief Shifts the elements from a position one place towards the end, leaving the position uninitialised.
+     * @param position The position to free, which must not be greater than the size.
+     */
+    void OpenGap(size_t position);
 };
 
 template<typename T>
-Vector<T>::Vector() : m_data(nullptr), m_size(0), m_capacity(0) {}
+Vector<T>::Vector() : m_data(nullptr), m_size(0), m_capacity(0), m_growthFactor(2.0) {}
 
 template<typename T>
-Vector<T>::Vector(size_t initialSize) : m_data(nullptr), m_size(initialSize), m_capacity(initialSize)
+Vector<T>::Vector(size_t initialSize) : m_data(nullptr), m_size(0), m_capacity(initialSize), m_growthFactor(2.0)
 {
-    m_data = new T[m_capacity];
+    m_data = Allocate(m_capacity);
+    for (; m_size < initialSize; ++m_size)
+    {
+        new (m_data + m_size) T();
+    }
 }
 
 template<typename T>
-Vector<T>::Vector(size_t initialSize, const T& value) : m_data(nullptr), m_size(initialSize), m_capacity(initialSize)
+Vector<T>::Vector(size_t initialSize, const T& value) : m_data(nullptr), m_size(0), m_capacity(initialSize), m_growthFactor(2.0)
 {
-    m_data = new T[m_capacity];
-    for (size_t i = 0; i < m_size; ++i)
+    m_data = Allocate(m_capacity);
+    for (; m_size < initialSize; ++m_size)
     {
-        m_data[i] = value;
+        new (m_data + m_size) T(value);
     }
 }
 
 template<typename T>
-Vector<T>::Vector(const Vector& other) : m_data(nullptr), m_size(other.m_size), m_capacity(other.m_capacity)
+Vector<T>::Vector(const Vector& other) : m_data(nullptr), m_size(0), m_capacity(other.m_capacity), m_growthFactor(other.m_growthFactor)
 {
-    m_data = new T[m_capacity];
-    CopyElements(other, *this);
+    m_data = Allocate(m_capacity);
+    CopyElements(other);
 }
 
 template<typename T>
@@ -170,8 +271,35 @@ Vector<T>& Vector<T>::operator=(const Vector& other)
     {
         Vector<T> temp(other);
         std::swap(m_data, temp.m_data);
-        m_size = temp.m_size;
-        m_capacity = temp.m_capacity;
+        std::swap(m_size, temp.m_size);
+        std::swap(m_capacity, temp.m_capacity);
+        m_growthFactor = temp.m_growthFactor;
+    }
+    return *this;
+}
+
+template<typename T>
+Vector<T>::Vector(Vector&& other) noexcept : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity), m_growthFactor(other.m_growthFactor)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_capacity = 0;
+}
+
+template<typename T>
+Vector<T>& Vector<T>::operator=(Vector&& other) noexcept
+{
+    if (this != &other)
+    {
+        DestroyElements(0, m_size);
+        std::free(m_data);
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        m_growthFactor = other.m_growthFactor;
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
     }
     return *this;
 }
@@ -179,7 +307,8 @@ Vector<T>& Vector<T>::operator=(const Vector& other)
 template<typename T>
 Vector<T>::~Vector()
 {
-    delete[] m_data;
+    DestroyElements(0, m_size);
+    std::free(m_data);
 }
 
 template<typename T>
@@ -208,13 +337,31 @@ T& Vector<T>::operator[](size_t index) const
 
 template<typename T>
 void Vector<T>::PushBack(const T& value)
+{
+    EmplaceBack(value);
+}
+
+template<typename T>
+void Vector<T>::PushBack(T&& value)
+{
+    EmplaceBack(std::move(value));
+}
+
+template<typename T>
+template <typename... Args>
+void Vector<T>::EmplaceBack(Args&&... args)
 {
     if (m_size == m_capacity)
     {
-        Reserve(m_capacity == 0 ? 1 : m_capacity * 2);
+        // The arguments may refer to an element of this vector, so the new element is built before the storage moves.
+        T value(std::forward<Args>(args)...);
+        Reserve(NextCapacity());
+        new (m_data + m_size) T(std::move(value));
+    }
+    else
+    {
+        new (m_data + m_size) T(std::forward<Args>(args)...);
     }
-
-    m_data[m_size] = value;
     ++m_size;
 }
 
@@ -224,28 +371,27 @@ void Vector<T>::PopBack()
     if (m_size > 0)
     {
         --m_size;
+        DestroyElements(m_size, m_size + 1);
     }
 }
 
 template<typename T>
 void Vector<T>::Insert(const T& value, size_t position)
+{
+    // Copying first keeps the value valid if it refers to an element that is about to be shifted.
+    Insert(T(value), position);
+}
+
+template<typename T>
+void Vector<T>::Insert(T&& value, size_t position)
 {
     if (position > m_size)
     {
         throw std::out_of_range("Invalid position");
     }
 
-    if (m_size == m_capacity)
-    {
-        Reserve(m_capacity == 0 ? 1 : m_capacity * 2);
-    }
-
-    for (size_t i = m_size; i > position; --i)
-    {
-        m_data[i] = m_data[i - 1];
-    }
-
-    m_data[position] = value;
+    OpenGap(position);
+    new (m_data + position) T(std::move(value));
     ++m_size;
 }
 
@@ -257,9 +403,17 @@ void Vector<T>::Erase(size_t position)
         throw std::out_of_range("Invalid position");
     }
 
-    for (size_t i = position; i < m_size - 1; ++i)
+    if constexpr (IsTrivial)
     {
-        m_data[i] = m_data[i + 1];
+        std::memmove(static_cast<void*>(m_data + position), m_data + position + 1, (m_size - position - 1) * sizeof(T));
+    }
+    else
+    {
+        for (size_t i = position; i < m_size - 1; ++i)
+        {
+            m_data[i] = std::move(m_data[i + 1]);
+        }
+        DestroyElements(m_size - 1, m_size);
     }
 
     --m_size;
@@ -268,6 +422,7 @@ void Vector<T>::Erase(size_t position)
 template<typename T>
 void Vector<T>::Clear()
 {
+    DestroyElements(0, m_size);
     m_size = 0;
 }
 
@@ -283,9 +438,13 @@ void Vector<T>::Resize(size_t newSize)
     {
         for (size_t i = m_size; i < newSize; ++i)
         {
-            m_data[i] = T();
+            new (m_data + i) T();
         }
     }
+    else
+    {
+        DestroyElements(newSize, m_size);
+    }
 
     m_size = newSize;
 }
@@ -295,19 +454,127 @@ void Vector<T>::Reserve(size_t newCapacity)
 {
     if (newCapacity > m_capacity)
     {
-        Vector<T> temp(newCapacity);
-        CopyElements(*this, temp);
-        std::swap(m_data, temp.m_data);
+        if constexpr (IsTrivial)
+        {
+            void* block = std::realloc(m_data, newCapacity * sizeof(T));
+            if (block == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            m_data = static_cast<T*>(block);
+        }
+        else
+        {
+            T* block = Allocate(newCapacity);
+            MoveElements(block);
+            std::free(m_data);
+            m_data = block;
+        }
         m_capacity = newCapacity;
     }
 }
 
 template<typename T>
-void Vector<T>::CopyElements(const Vector& source, Vector& destination)
+double Vector<T>::GrowthFactor() const
+{
+    return m_growthFactor;
+}
+
+template<typename T>
+void Vector<T>::SetGrowthFactor(double factor)
+{
+    if (!(factor > 1.0))
+    {
+        throw std::invalid_argument("Growth factor must be greater than 1");
+    }
+    m_growthFactor = factor;
+}
+
+template<typename T>
+T* Vector<T>::Allocate(size_t capacity)
+{
+    if (capacity == 0)
+    {
+        return nullptr;
+    }
+
+    void* block = std::malloc(capacity * sizeof(T));
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return static_cast<T*>(block);
+}
+
+template<typename T>
+void Vector<T>::DestroyElements(size_t first, size_t last)
+{
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+        for (size_t i = first; i < last; ++i)
+        {
+            m_data[i].~T();
+        }
+    }
+}
+
+template<typename T>
+void Vector<T>::CopyElements(const Vector& source)
 {
-    for (size_t i = 0; i < source.m_size; ++i)
+    if constexpr (IsTrivial)
+    {
+        if (source.m_size > 0)
+        {
+            std::memcpy(static_cast<void*>(m_data), source.m_data, source.m_size * sizeof(T));
+        }
+        m_size = source.m_size;
+    }
+    else
+    {
+        for (; m_size < source.m_size; ++m_size)
+        {
+            new (m_data + m_size) T(source.m_data[m_size]);
+        }
+    }
+}
+
+template<typename T>
+void Vector<T>::MoveElements(T* destination)
+{
+    for (size_t i = 0; i < m_size; ++i)
     {
-        destination.m_data[i] = source.m_data[i];
+        new (destination + i) T(std::move(m_data[i]));
+        m_data[i].~T();
+    }
+}
+
+template<typename T>
+size_t Vector<T>::NextCapacity() const
+{
+    size_t next = static_cast<size_t>(m_capacity * m_growthFactor);
+    return next > m_capacity ? next : m_capacity + 1;
+}
+
+template<typename T>
+void Vector<T>::OpenGap(size_t position)
+{
+    if (m_size == m_capacity)
+    {
+        Reserve(NextCapacity());
+    }
+
+    if constexpr (IsTrivial)
+    {
+        std::memmove(static_cast<void*>(m_data + position + 1), m_data + position, (m_size - position) * sizeof(T));
+    }
+    else if (position < m_size)
+    {
+        new (m_data + m_size) T(std::move(m_data[m_size - 1]));
+        for (size_t i = m_size - 1; i > position; --i)
+        {
+            m_data[i] = std::move(m_data[i - 1]);
+        }
+        m_data[position].~T();
     }
 }
 
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <string>
+#include <utility>
 
 #include "Vector.h"
 
@@ -15,6 +17,8 @@ void TestClear();
 void TestResize();
 void TestReserve();
 void TestException();
+void TestMoveAndEmplace();
+void TestGrowthAndNonTrivialElements();
 
 
 void TestDefaultConstructor()
@@ -200,6 +204,85 @@ void TestException()
     }
 }
 
+void TestMoveAndEmplace()
+{
+    std::cout << "-- Testing Move Semantics and EmplaceBack --\n";
+    Vector<std::string> vec1;
+    vec1.EmplaceBack(3, 'a');
+    vec1.EmplaceBack("wind");
+    std::string solar = "solar";
+    vec1.PushBack(std::move(solar));
+    vec1.Insert(std::string("temperature"), 0);
+    std::cout << "Elements: ";
+    for (size_t i = 0; i < vec1.Size(); ++i)
+    {
+        std::cout << vec1[i] << " ";
+    }
+    std::cout << std::endl;
+
+    Vector<std::string> vec2(std::move(vec1));
+    std::cout << "Moved vector size: " << vec2.Size() << ", source size: " << vec1.Size() << std::endl;
+
+    Vector<std::string> vec3(2, "x");
+    vec3 = std::move(vec2);
+    std::cout << "Move-assigned vector: ";
+    for (size_t i = 0; i < vec3.Size(); ++i)
+    {
+        std::cout << vec3[i] << " ";
+    }
+    std::cout << "(source size " << vec2.Size() << ")" << std::endl;
+
+    vec1.PushBack("reused");
+    std::cout << "Moved-from vector after PushBack(): " << vec1[0] << std::endl;
+}
+
+void TestGrowthAndNonTrivialElements()
+{
+    std::cout << "-- Testing Growth Factor and Non-Trivial Elements --\n";
+    Vector<int> vec;
+    vec.SetGrowthFactor(1.5);
+    std::cout << "Capacities: ";
+    size_t capacity = vec.Capacity();
+    for (int i = 0; i < 20; ++i)
+    {
+        vec.PushBack(i);
+        if (vec.Capacity() != capacity)
+        {
+            capacity = vec.Capacity();
+            std::cout << capacity << " ";
+        }
+    }
+    std::cout << std::endl;
+    vec.PushBack(vec[0]);
+    std::cout << "Last element after PushBack(vec[0]): " << vec[vec.Size() - 1] << std::endl;
+
+    try
+    {
+        vec.SetGrowthFactor(1.0);
+    }
+    catch (const std::exception& ex)
+    {
+        std::cout << "Exception: " << ex.what() << std::endl;
+    }
+
+    Vector<std::string> words;
+    words.PushBack("wind");
+    words.PushBack("solar");
+    words.Insert(words[1], 0);
+    words.Insert("temperature", 2);
+    words.Erase(1);
+    words.Resize(5);
+    words[4] = "humidity";
+    words.Resize(4);
+    Vector<std::string> copy(words);
+    std::cout << "Words: ";
+    for (size_t i = 0; i < copy.Size(); ++i)
+    {
+        std::cout << "[" << copy[i] << "] ";
+    }
+    std::cout << std::endl;
+}
+
 int main()
 {
     TestDefaultConstructor();
@@ -239,6 +322,12 @@ int main()
     std::cout << std::endl;
 
     TestException();
+    std::cout << std::endl;
+
+    TestMoveAndEmplace();
+    std::cout << std::endl;
+
+    TestGrowthAndNonTrivialElements();
 
     return 0;
 }
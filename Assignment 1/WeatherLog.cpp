@@ -1,11 +1,11 @@
 #include "WeatherLog.h"
 
-WeatherLog::WeatherLog() : m_date(), m_time(), m_speed(0.0f), m_ambientTemperature(0.0f), m_solarRadiation(0.0f)
+WeatherLog::WeatherLog() : m_timestamp(0), m_speed(0.0f), m_ambientTemperature(0.0f), m_solarRadiation(0.0f)
 {
 }
 
-WeatherLog::WeatherLog(Date& date, Time& time, int& windSpeed, float& ambientTemperature, float& solarRadiation)
-    : m_date(date), m_time(time), m_speed(windSpeed), m_ambientTemperature(ambientTemperature), m_solarRadiation(solarRadiation)
+WeatherLog::WeatherLog(const Date& date, const Time& time, int windSpeed, float ambientTemperature, float solarRadiation)
+    : m_timestamp(static_cast<std::uint32_t>(Timestamp::FromDateTime(date, time).GetValue())), m_speed(windSpeed), m_ambientTemperature(ambientTemperature), m_solarRadiation(solarRadiation)
 {
 }
 
@@ -58,12 +58,17 @@ float WeatherLog::GetSolarRadiation() const
     return m_solarRadiation;
 }
 
-const Date& WeatherLog::GetDate() const
+Date WeatherLog::GetDate() const
 {
-    return m_date;
+    return GetTimestamp().GetDate();
 }
 
-const Time& WeatherLog::GetTime() const
+Time WeatherLog::GetTime() const
 {
-    return m_time;
+    return GetTimestamp().GetTime();
+}
+
+Timestamp WeatherLog::GetTimestamp() const
+{
+    return Timestamp(m_timestamp);
 }
@@ -6,8 +6,11 @@
  * ambient temperature, solar radiation, date, and time. It provides functions to set and
  * retrieve these values.
  *
+ * The date and time are stored packed into a single 32-bit value using the Timestamp bit layout, so a record
+ * takes 16 bytes instead of 32. GetDate() and GetTime() decode the packed value on demand.
+ *
  * @author Mohsin Ali Khan
- * @version 02
+ * @version 03
  * @date 11/06/2023
  *
  * @bug No known bugs to the best of my knowledge
@@ -17,10 +20,11 @@
 #ifndef WEATHERLOG_H
 #define WEATHERLOG_H
 
-#include <string>
+#include <cstdint>
 
 #include "Date.h"
 #include "Time.h"
+#include "Timestamp.h"
 
 class WeatherLog
 {
@@ -30,7 +34,15 @@ public:
      */
     WeatherLog();
 
-    WeatherLog(Date& date, Time& time, int& windSpeed, float& ambientTemperature, float& solarRadiation);
+    /**
+     * @brief Parameterized constructor for the WeatherLog class.
+     * @param date The date of the weather log entry.
+     * @param time The time of the weather log entry.
+     * @param windSpeed The wind speed value of the weather log entry.
+     * @param ambientTemperature The ambient temperature value of the weather log entry.
+     * @param solarRadiation The solar radiation value of the weather log entry.
+     */
+    WeatherLog(const Date& date, const Time& time, int windSpeed, float ambientTemperature, float solarRadiation);
 
     /**
      * @brief Sets the speed value of the weather log entry.
@@ -75,17 +87,22 @@ public:
      * @brief Gets the date object associated with the weather log entry.
      * @return The date object.
      */
-    const Date& GetDate() const;
+    Date GetDate() const;
 
     /**
      * @brief Gets the time object associated with the weather log entry.
      * @return The time object.
      */
-    const Time& GetTime() const;
+    Time GetTime() const;
+
+    /**
+     * @brief Gets the packed date and time of the weather log entry.
+     * @return The timestamp of the weather log entry.
+     */
+    Timestamp GetTimestamp() const;
 
 private:
-    Date m_date;                    /**< The date of the weather log entry. */
-    Time m_time;                    /**< The time of the weather log entry. */
+    std::uint32_t m_timestamp;      /**< The date and time of the weather log entry, packed as by Timestamp. */
     float m_speed;                  /**< The speed value of the weather log entry. */
     float m_ambientTemperature;     /**< The ambient temperature value of the weather log entry. */
     float m_solarRadiation;         /**< The solar radiation value of the weather log entry. */
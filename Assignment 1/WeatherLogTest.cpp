@@ -6,6 +6,7 @@ void TestWeatherLogNonDefaultConstructor();
 void TestWeatherLogSetSpeed();
 void TestWeatherLogSetAmbientTemperature();
 void TestWeatherLogSetSolarRadiation();
+void TestWeatherLogDateTime();
 
 void TestWeatherLogDefaultConstructor()
 {
@@ -63,6 +64,15 @@ void TestWeatherLogSetSolarRadiation()
         std::cout << "Invalid solar radiation. Solar radiation not set.\n";
 }
 
+void TestWeatherLogDateTime()
+{
+    std::cout << "-- Testing WeatherLog GetDate() and GetTime() --\n";
+    WeatherLog weatherLog(Date(31, 12, 2015), Time(23, 50), 15, 25.0f, 1000.0f);
+    std::cout << "Date: " << weatherLog.GetDate().DateToString() << std::endl;
+    std::cout << "Time: " << weatherLog.GetTime().TimeToString() << std::endl;
+    std::cout << "Record size: " << sizeof(WeatherLog) << " bytes" << std::endl;
+}
+
 int main()
 {
     TestWeatherLogDefaultConstructor();
@@ -74,6 +84,8 @@ int main()
     TestWeatherLogSetAmbientTemperature();
     std::cout << std::endl;
     TestWeatherLogSetSolarRadiation();
+    std::cout << std::endl;
+    TestWeatherLogDateTime();
 
     return 0;
 }
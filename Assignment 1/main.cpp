@@ -3,52 +3,44 @@
 #include <string>
 #include <sstream>
 #include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+#include <thread>
+#include <vector>
 #include "WeatherLog.h"
 #include "Vector.h"
 #include "Parse.h"
+#include "MappedFile.h"
+#include "RunningStats.h"
 
-float CalculateAverage(const Vector<float>& vec);
-float CalculateTotal(const Vector<float>& vec);
-float CalculateStandardDeviation(const Vector<float>& values);
 void PrintAverageWindSpeedAndStandardDeviation(const Vector<WeatherLog>& logs, unsigned int month, unsigned int year);
 void PrintAverageTemperatureAndStandardDeviation(const Vector<WeatherLog>& logs, unsigned int year);
 void PrintTotalSolarRadiationByYear(const Vector<WeatherLog>& logs, unsigned int year);
 void WriteDataToFile(const Vector<WeatherLog>& logs, unsigned int year);
 bool ValidateInput(const std::string& input, int& value);
+bool LoadWeatherLogs(const std::string& path, Vector<WeatherLog>& weatherLogs, unsigned int threadCount);
+void ParseChunk(std::string_view bytes, const ColumnPlan& plan, ColumnBatch& batch);
+const char* AlignToNextLine(const char* position, const char* begin, const char* end);
 
 
-int main()
+int main(int argc, char* argv[])
 {
-    Vector<WeatherLog> weatherLogs;
-    std::ifstream inputFile("data/MetData_Mar01-2014-Mar01-2015-ALL.csv");
-    if (!inputFile)
+    // "--threads N" sets how many byte ranges of the input file are parsed in parallel.
+    unsigned int threadCount = std::thread::hardware_concurrency();
+    int value;
+    if (argc > 2 && std::string(argv[1]) == "--threads" && ValidateInput(argv[2], value) && value > 0)
     {
-        std::cout << "Failed to open input file." << std::endl;
-        return 1;
+        threadCount = static_cast<unsigned int>(value);
     }
 
-    std::string line;
-    while (std::getline(inputFile, line))
+    Vector<WeatherLog> weatherLogs;
+    if (!LoadWeatherLogs("data/MetData_Mar01-2014-Mar01-2015-ALL.csv", weatherLogs, threadCount))
     {
-        Parse parser;
-        parser.ParseLog(line);
-
-        unsigned int day = parser.GetParseDay();
-        unsigned int month = parser.GetParseMonth();
-        unsigned int year = parser.GetParseYear();
-        unsigned int hour = parser.GetParseHour();
-        unsigned int minute = parser.GetParseMinutes();
-        int windSpeed = parser.GetParseWS();
-        float solarRadiation = parser.GetParseSR();
-        float ambientTemperature = parser.GetParseAT();
-
-        Date date(day, month, year);
-        Time time(hour, minute);
-
-        WeatherLog log(date, time, windSpeed, ambientTemperature, solarRadiation);
-        weatherLogs.PushBack(log);
+        std::cout << "Failed to open input file." << std::endl;
+        return 1;
     }
-    inputFile.close();
 
     const int ExitOption = 5;
     int selectedOption;
@@ -144,82 +136,127 @@ int main()
     return 0;
 }
 
-bool ValidateInput(const std::string& input, int& value)
+bool LoadWeatherLogs(const std::string& path, Vector<WeatherLog>& weatherLogs, unsigned int threadCount)
 {
-    try
+    MappedFile inputFile;
+    if (!inputFile.Open(path))
     {
-        size_t pos;
-        value = std::stoi(input, &pos);
+        return false;
+    }
 
-        if (pos != input.length())
-            return false;
+    auto loadStart = std::chrono::steady_clock::now();
 
-        if (value < 0)
-            return false;
+    // The header is read once, and its column plan is shared by every byte range of the file.
+    ColumnPlan plan;
+    std::string_view bytes = Parse::ReadHeader(std::string_view(inputFile.Data(), inputFile.Size()), plan);
+    const char* begin = bytes.data();
+    const char* end = begin + bytes.size();
 
-        return true;
+    if (threadCount == 0)
+    {
+        threadCount = 1;
     }
-    catch (...)
+
+    // Split the file into equal byte ranges, then move every boundary forward to the start of a line so
+    // that each line belongs to exactly one range.
+    std::vector<const char*> boundaries(threadCount + 1, end);
+    boundaries[0] = begin;
+    for (unsigned int i = 1; i < threadCount; i++)
     {
-        return false;
+        const char* position = begin + (end - begin) * i / threadCount;
+        boundaries[i] = AlignToNextLine(std::max(position, boundaries[i - 1]), begin, end);
     }
-}
 
-float CalculateAverage(const Vector<float>& vec)
-{
-    float sum = 0.0f;
-    for (size_t i = 0; i < vec.Size(); i++)
+    std::vector<ColumnBatch> partitions(threadCount);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < threadCount; i++)
+    {
+        std::string_view range(boundaries[i], boundaries[i + 1] - boundaries[i]);
+        threads.emplace_back(ParseChunk, range, std::cref(plan), std::ref(partitions[i]));
+    }
+    ParseChunk(std::string_view(boundaries[0], boundaries[1] - boundaries[0]), plan, partitions[0]);
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    // Concatenating the ranges in file order gives the same sequence as a sequential parse.
+    size_t rowCount = 0;
+    for (size_t i = 0; i < partitions.size(); i++)
+    {
+        rowCount += partitions[i].Size();
+    }
+    weatherLogs.Reserve(weatherLogs.Size() + rowCount);
+    for (size_t i = 0; i < partitions.size(); i++)
     {
-        sum += vec[i];
+        for (size_t j = 0; j < partitions[i].Size(); j++)
+        {
+            weatherLogs.PushBack(partitions[i].GetLog(j));
+        }
     }
-    return sum / static_cast<float>(vec.Size());
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - loadStart).count();
+    std::cout << "Parsed " << rowCount << " rows on " << threadCount << " thread(s) in " << seconds << " s" << std::endl;
+
+    return true;
 }
 
-float CalculateTotal(const Vector<float>& vec)
+const char* AlignToNextLine(const char* position, const char* begin, const char* end)
 {
-    float total = 0.0f;
-    for (size_t i = 0; i < vec.Size(); i++)
+    if (position == begin || position == end || position[-1] == '\n')
     {
-        total += vec[i];
+        return position;
     }
-    return total;
+
+    const char* newline = static_cast<const char*>(std::memchr(position, '\n', end - position));
+    return newline == nullptr ? end : newline + 1;
 }
 
-float CalculateStandardDeviation(const Vector<float>& values)
+void ParseChunk(std::string_view bytes, const ColumnPlan& plan, ColumnBatch& batch)
 {
-    float mean = CalculateAverage(values);
-    float variance = 0.0f;
-    for (size_t i = 0; i < values.Size(); i++)
+    Parse::ParseBuffer(bytes, plan, batch);
+}
+
+bool ValidateInput(const std::string& input, int& value)
+{
+    try
     {
-        float diff = values[i] - mean;
-        variance += diff * diff;
+        size_t pos;
+        value = std::stoi(input, &pos);
+
+        if (pos != input.length())
+            return false;
+
+        if (value < 0)
+            return false;
+
+        return true;
+    }
+    catch (...)
+    {
+        return false;
     }
-    variance /= static_cast<float>(values.Size());
-    return std::sqrt(variance);
 }
 
 
 void PrintAverageWindSpeedAndStandardDeviation(const Vector<WeatherLog>& logs, unsigned int month, unsigned int year)
 {
-    Vector<float> windSpeeds;
+    RunningStats windSpeeds;
 
     for (size_t i = 0; i < logs.Size(); i++)
     {
-        WeatherLog log = logs[i];
+        const WeatherLog& log = logs[i];
         if (log.GetDate().GetMonth() == month && log.GetDate().GetYear() == year)
         {
-            windSpeeds.PushBack(log.GetSpeed());
+            windSpeeds.Add(log.GetSpeed());
         }
     }
 
-    if (windSpeeds.Size() > 0)
+    if (windSpeeds.Count() > 0)
     {
-        float averageWindSpeed = CalculateAverage(windSpeeds);
-        float standardDeviation = CalculateStandardDeviation(windSpeeds);
-
         std::cout << Date::MonthToString(month) << " " << year << ":" << std::endl;
-        std::cout << "Average Wind Speed: " << averageWindSpeed << " km/h" << std::endl;
-        std::cout << "Sample Standard Deviation: " << standardDeviation << std::endl;
+        std::cout << "Average Wind Speed: " << windSpeeds.Mean() << " km/h" << std::endl;
+        std::cout << "Sample Standard Deviation: " << windSpeeds.SampleStandardDeviation() << std::endl;
     }
     else
     {
@@ -232,28 +269,23 @@ void PrintAverageTemperatureAndStandardDeviation(const Vector<WeatherLog>& logs,
 {
     for (unsigned int month = 1; month <= 12; month++)
     {
-        Vector<float> temperatures;
-        bool hasData = false;
+        RunningStats temperatures;
 
         for (size_t i = 0; i < logs.Size(); i++)
         {
-            WeatherLog log = logs[i];
+            const WeatherLog& log = logs[i];
             if (log.GetDate().GetYear() == year && log.GetDate().GetMonth() == month)
             {
-                temperatures.PushBack(log.GetAmbientTemperature());
-                hasData = true;
+                temperatures.Add(log.GetAmbientTemperature());
             }
         }
 
         std::cout << Date::MonthToString(month) << " " << year << ":" << std::endl;
 
-        if (hasData)
+        if (temperatures.Count() > 0)
         {
-            float averageTemperature = CalculateAverage(temperatures);
-            float standardDeviation = CalculateStandardDeviation(temperatures);
-
-            std::cout << "Average temperature: " << averageTemperature << " degrees Celsius" << std::endl;
-            std::cout << "Standard deviation of temperature: " << standardDeviation << std::endl;
+            std::cout << "Average temperature: " << temperatures.Mean() << " degrees Celsius" << std::endl;
+            std::cout << "Standard deviation of temperature: " << temperatures.SampleStandardDeviation() << std::endl;
         }
         else
         {
@@ -268,15 +300,15 @@ void PrintAverageTemperatureAndStandardDeviation(const Vector<WeatherLog>& logs,
 void PrintTotalSolarRadiationByYear(const Vector<WeatherLog>& logs, unsigned int year)
 {
 
-    float solarRadiations[12] = {0.0f};
+    RunningStats solarRadiations[12];
 
     for (size_t i = 0; i < logs.Size(); i++)
     {
-        WeatherLog log = logs[i];
+        const WeatherLog& log = logs[i];
         if (log.GetDate().GetYear() == year)
         {
             unsigned int month = log.GetDate().GetMonth();
-            solarRadiations[month - 1] += log.GetSolarRadiation();
+            solarRadiations[month - 1].Add(log.GetSolarRadiation());
         }
     }
 
@@ -284,9 +316,9 @@ void PrintTotalSolarRadiationByYear(const Vector<WeatherLog>& logs, unsigned int
     for (unsigned int month = 1; month <= 12; month++)
     {
         std::cout << Date::MonthToString(month) << ": ";
-        if (solarRadiations[month - 1] > 0.0f)
+        if (solarRadiations[month - 1].Sum() > 0.0)
         {
-            float solarRadiationInKWh = solarRadiations[month - 1] / 3.6f;
+            double solarRadiationInKWh = solarRadiations[month - 1].Sum() / 3.6;
             std::cout << solarRadiationInKWh << " kWh/m2" << std::endl;
         }
         else
@@ -309,32 +341,26 @@ void WriteDataToFile(const Vector<WeatherLog>& logs, unsigned int year)
 
         for (unsigned int month = 1; month <= 12; ++month)
         {
-            Vector<float> windSpeeds;
-            Vector<float> temperatures;
-            Vector<float> solarRadiations;
+            RunningStats windSpeeds;
+            RunningStats temperatures;
+            RunningStats solarRadiations;
 
             for (size_t i = 0; i < logs.Size(); ++i)
             {
-                WeatherLog log = logs[i];
+                const WeatherLog& log = logs[i];
                 if (log.GetDate().GetYear() == year && log.GetDate().GetMonth() == month)
                 {
-                    windSpeeds.PushBack(log.GetSpeed());
-                    temperatures.PushBack(log.GetAmbientTemperature());
-                    solarRadiations.PushBack(log.GetSolarRadiation());
+                    windSpeeds.Add(log.GetSpeed());
+                    temperatures.Add(log.GetAmbientTemperature());
+                    solarRadiations.Add(log.GetSolarRadiation());
                 }
             }
 
-            if (windSpeeds.Size() > 0 && temperatures.Size() > 0 && solarRadiations.Size() > 0)
+            if (windSpeeds.Count() > 0 && temperatures.Count() > 0 && solarRadiations.Count() > 0)
             {
                 hasData = true;
-                float averageWindSpeed = CalculateAverage(windSpeeds);
-                float averageTemperature = CalculateAverage(temperatures);
-                float totalSolarRadiation = CalculateTotal(solarRadiations);
-                float windSpeedStdDev = CalculateStandardDeviation(windSpeeds);
-                float temperatureStdDev = CalculateStandardDeviation(temperatures);
-
-                outputFile << Date::MonthToString(month) << "," << averageWindSpeed << "(" << windSpeedStdDev << "),"
-                           << averageTemperature << "(" << temperatureStdDev << ")," << totalSolarRadiation << "\n";
+                outputFile << Date::MonthToString(month) << "," << windSpeeds.Mean() << "(" << windSpeeds.SampleStandardDeviation() << "),"
+                           << temperatures.Mean() << "(" << temperatures.SampleStandardDeviation() << ")," << solarRadiations.Sum() << "\n";
             }
         }
 
@@ -5,9 +5,28 @@
  * temperatures, and solar radiation levels. It uses BSTs for fast search times (O(log n)) to efficiently calculate
  * statistics like mean and standard deviation (O(n)) by traversing the tree. The BST class also supports insertion,
  * in-order, pre-order, and post-order traversals, tree deletion, and search operations.
+ * The tree is kept balanced as an AVL tree: every insertion rebalances the path back to the root with rotations, so the
+ * height stays below 1.45 log2(n + 2) even when values arrive in sorted or reverse-sorted runs, and insertion, search and
+ * the recursive helpers all run in O(log n) depth.
+ * Every node also stores the number of values in its subtree, so size() is O(1) and the order statistics Select(),
+ * Rank(), Median() and Percentile() descend a single path in O(log n) without traversing the tree.
+ * A BST constructed as a multiset keeps equal values instead of ignoring them: each node holds one distinct value and
+ * the number of times it was inserted, the traversals visit a value once per occurrence, and InOrderCounted() visits
+ * each distinct value once with its count, so data with few distinct values needs only a few nodes.
+ * Nodes are obtained from the Allocator template parameter, by default a NodePool that carves them out of contiguous
+ * slabs, so building a tree makes few heap allocations and DeleteTree() or the destructor release it slab by slab.
+ * Once a tree will no longer change, Freeze() copies its distinct values into a FrozenBST, a pointer-free array in
+ * Eytzinger order that is searched branchlessly.
+ * A whole range of values can be loaded at once with BuildFromSorted(), which builds a perfectly balanced tree from
+ * sorted input in linear time, or Build(), which sorts a copy of the input first.
+ * Every node links back to its parent, so the tree is walked without a stack: Iterator moves to the next or previous
+ * value in amortised O(1), the pointer-based traversals use no extra memory, and LowerBound(), UpperBound() and
+ * ForEachInRange() visit only the values in a range, in O(log n + k) for k values.
+ * Trees can be moved in O(1), handing over their nodes and allocator, and values can be moved into a tree with
+ * Insert() or constructed directly inside a new node with Emplace().
  * @author Mohsin Ali Khan
  * @date 26/07/2023
- * @version 04
+ * @version 12
  * @bug All the bugs have been fixed to the best of my knowledge
  */
 
@@ -15,7 +34,15 @@
 #define BST_H
 
 #include <iostream>
-#include <stack>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "NodePool.h"
+#include "FrozenBST.h"
 
 using namespace std;
 
@@ -25,23 +52,132 @@ struct node
     /**
      * @brief Default constructor for a node.
      */
-    node() : data(T()), left(nullptr), right(nullptr)
+    node() : data(T()), left(nullptr), right(nullptr), parent(nullptr), height(1), count(1), occurrences(1)
+    {
+    }
+
+    /**
+     * @brief Constructor for a node whose data is built from constructor arguments.
+     * @param args The arguments passed to the constructor of T.
+     */
+    template <typename... Args>
+    explicit node(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), left(nullptr), right(nullptr), parent(nullptr), height(1), count(1), occurrences(1)
     {
     }
 
     T data; ///< Data stored in the node.
     node* left; ///< Pointer to the left child node.
     node* right; ///< Pointer to the right child node.
+    node* parent; ///< Pointer to the parent node, nullptr for the root.
+    int height; ///< Height of the subtree rooted at this node, 1 for a leaf.
+    int count; ///< Number of values in the subtree rooted at this node, counting every occurrence.
+    int occurrences; ///< Number of times data was inserted, always 1 unless the tree is a multiset.
 };
 
-template <class T>
+template <class T, class Allocator = NodePool<node<T>>>
 class BST
 {
 public:
+    /**
+     * @brief Bidirectional iterator over the distinct values of the BST in increasing order.
+     */
+    class Iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category; ///< Iterator category.
+        typedef T value_type; ///< Type of the values.
+        typedef std::ptrdiff_t difference_type; ///< Type of the distance between iterators.
+        typedef const T* pointer; ///< Pointer to a value.
+        typedef const T& reference; ///< Reference to a value.
+
+        /**
+         * @brief Default constructor for the Iterator class. Creates an iterator that refers to no tree.
+         */
+        Iterator() : current(nullptr), treeRoot(nullptr)
+        {
+        }
+
+        /**
+         * @brief Constructs an iterator referring to a node.
+         * @param position The node, or nullptr for the end of the tree.
+         * @param rootNode The root node of the tree, used to step back from the end.
+         */
+        Iterator(node<T>* position, node<T>* rootNode) : current(position), treeRoot(rootNode)
+        {
+        }
+
+        const T& operator*() const
+        {
+            return current->data;
+        }
+
+        const T* operator->() const
+        {
+            return &current->data;
+        }
+
+        /**
+         * @brief Gets the number of occurrences of the current value.
+         * @return The number of times the value was inserted, always 1 unless the tree is a multiset.
+         */
+        int Occurrences() const
+        {
+            return current->occurrences;
+        }
+
+        Iterator& operator++()
+        {
+            current = Successor(current);
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        Iterator& operator--()
+        {
+            current = current == nullptr ? Maximum(treeRoot) : Predecessor(current);
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator previous = *this;
+            --(*this);
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return current == other.current;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return current != other.current;
+        }
+
+    private:
+        node<T>* current; ///< The node of the current value, nullptr at the end.
+        node<T>* treeRoot; ///< The root node of the tree.
+    };
+
     /**
      * @brief Constructor for the BST class.
+     * @param isMultiset True to count values equal to one already in the BST, false to ignore them.
      */
-    BST();
+    explicit BST(bool isMultiset = false);
+
+    /**
+     * @brief Checks if the BST counts equal values.
+     * @return True if the BST is a multiset, false otherwise.
+     */
+    bool IsMultiset() const;
 
     /**
      * @brief Destructor for the BST class.
@@ -49,11 +185,42 @@ public:
     ~BST();
 
     /**
-     * @brief Inserts a new data element into the BST.
+     * @brief Inserts a new data element into the BST. An equal element is counted again in a multiset and ignored otherwise.
      * @param data The data to be inserted.
      */
     void Insert(T &data);
 
+    /**
+     * @brief Inserts a new data element into the BST by moving it into the new node.
+     * @param data The data to be inserted.
+     */
+    void Insert(T &&data);
+
+    /**
+     * @brief Inserts a new data element built in place inside a new node from constructor arguments.
+     * @param args The arguments passed to the constructor of T.
+     */
+    template <typename... Args>
+    void Emplace(Args&&... args);
+
+    /**
+     * @brief Replaces the content of the BST with a range of values sorted in increasing order, in linear time.
+     * @tparam InputIterator The type of the iterators of the range.
+     * @param begin Iterator to the first value.
+     * @param end Iterator one past the last value.
+     */
+    template <typename InputIterator>
+    void BuildFromSorted(InputIterator begin, InputIterator end);
+
+    /**
+     * @brief Replaces the content of the BST with a range of values in any order, sorting a copy of them first.
+     * @tparam InputIterator The type of the iterators of the range.
+     * @param begin Iterator to the first value.
+     * @param end Iterator one past the last value.
+     */
+    template <typename InputIterator>
+    void Build(InputIterator begin, InputIterator end);
+
     /**
      * @brief Performs in-order traversal of the BST and applies a callback function to each node's data.
      * @param fptr Pointer to the callback function that takes a reference to the data element.
@@ -89,19 +256,65 @@ public:
      * @param that The BST to be copied from.
      * @return Reference to the newly copied BST.
      */
-    BST<T>& operator= (const BST<T>& that);
+    BST& operator= (const BST& that);
 
     /**
      * @brief Copy constructor to create a deep copy of another BST.
      * @param thatTree The BST to be copied.
      */
-    BST(const BST<T>& thatTree);
+    BST(const BST& thatTree);
+
+    /**
+     * @brief Move constructor that takes over the nodes of another BST.
+     * @param thatTree The BST to be moved from. It is left empty.
+     */
+    BST(BST&& thatTree) noexcept;
 
     /**
-     * @brief Get the size (number of nodes) of the BST.
+     * @brief Move assignment operator that takes over the nodes of another BST, deleting the current ones.
+     * @param that The BST to be moved from. It is left empty.
+     * @return Reference to this BST.
+     */
+    BST& operator= (BST&& that) noexcept;
+
+    /**
+     * @brief Get the size of the BST, counting every occurrence of a value in a multiset.
      * @return The size of the BST.
      */
-    int size();
+    int size() const;
+
+    /**
+     * @brief Gets the value at a position of the sorted order.
+     * @param k The zero-based position, which must be less than size().
+     * @return The k-th smallest value of the BST.
+     */
+    const T& Select(int k) const;
+
+    /**
+     * @brief Counts the values smaller than a given value.
+     * @param data The value to rank, which does not have to be in the BST.
+     * @return The number of values in the BST that are less than data.
+     */
+    int Rank(const T& data) const;
+
+    /**
+     * @brief Gets the median of the values. T must be convertible to double.
+     * @return The middle value, or the mean of the two middle values if size() is even, 0 for an empty BST.
+     */
+    double Median() const;
+
+    /**
+     * @brief Gets a percentile of the values, interpolating linearly between neighbouring ranks. T must be convertible to double.
+     * @param p The percentile, from 0 (smallest value) to 100 (largest value).
+     * @return The p-th percentile, 0 for an empty BST.
+     */
+    double Percentile(double p) const;
+
+    /**
+     * @brief Get the height of the BST.
+     * @return The number of nodes on the longest path from the root to a leaf, 0 for an empty tree.
+     */
+    int Height() const;
 
     /**
      * @brief Performs in-order traversal of the BST and applies a callback function to each node's data.
@@ -111,15 +324,67 @@ public:
     template <typename Callback>
     void InOrder(Callback callback);
 
+    /**
+     * @brief Performs in-order traversal of the BST, applying a callback function once per distinct value.
+     * @tparam Callback The type of the callback function.
+     * @param callback The callback function that takes a reference to the data element and its number of occurrences.
+     */
+    template <typename Callback>
+    void InOrderCounted(Callback callback);
+
+    /**
+     * @brief Copies the distinct values of the BST into an immutable, cache-friendly search tree.
+     * @return A FrozenBST holding the distinct values of the BST.
+     */
+    FrozenBST<T> Freeze() const;
+
+    /**
+     * @brief Gets an iterator to the smallest value.
+     * @return Iterator to the first value, equal to end() for an empty BST.
+     */
+    Iterator begin() const;
+
+    /**
+     * @brief Gets the iterator one past the largest value.
+     * @return The end iterator.
+     */
+    Iterator end() const;
+
+    /**
+     * @brief Finds the smallest value not less than a given value.
+     * @param data The value to search for.
+     * @return Iterator to that value, or end() if there is none.
+     */
+    Iterator LowerBound(const T& data) const;
+
+    /**
+     * @brief Finds the smallest value greater than a given value.
+     * @param data The value to search for.
+     * @return Iterator to that value, or end() if there is none.
+     */
+    Iterator UpperBound(const T& data) const;
+
+    /**
+     * @brief Applies a callback function to every value in a closed range, in increasing order.
+     * @tparam Callback The type of the callback function.
+     * @param low The smallest value of the range.
+     * @param high The largest value of the range.
+     * @param callback The callback function that takes a const reference to the data element, called once per occurrence.
+     */
+    template <typename Callback>
+    void ForEachInRange(const T& low, const T& high, Callback callback) const;
+
 private:
     node<T>* root; ///< Pointer to the root node of the BST.
+    Allocator allocator; ///< Allocator of the nodes of the BST.
+    bool multiset; ///< True if equal values are counted instead of ignored.
 
     /**
-     * @brief Helper function to calculate the size of the BST starting from a given node.
-     * @param parent Pointer to the root node of the subtree.
-     * @return The size of the subtree.
+     * @brief Helper function to get the size of the BST starting from a given node.
+     * @param parent Pointer to the root node of the subtree, may be nullptr.
+     * @return The size of the subtree, 0 for nullptr.
      */
-    int size(node<T>* parent);
+    static int size(const node<T>* parent);
 
     /**
      * @brief Helper function to perform in-order traversal of the BST starting from a given node.
@@ -131,11 +396,97 @@ private:
     void InOrder(node<T>* parent, Callback callback);
 
     /**
-     * @brief Helper function to insert a new data element into the BST starting from a given node.
+     * @brief Helper function to perform counted in-order traversal of the BST starting from a given node.
+     * @tparam Callback The type of the callback function.
      * @param parent Pointer to the root node of the subtree.
-     * @param data The data to be inserted.
+     * @param callback The callback function that takes a reference to the data element and its number of occurrences.
+     */
+    template <typename Callback>
+    void InOrderCounted(node<T>* parent, Callback callback);
+
+    /**
+     * @brief Helper function to link a new node into the BST starting from a given node.
+     * @param parent Pointer to the root node of the subtree, may be nullptr.
+     * @param fresh Pointer to the new node. It is released if its data is already in the BST.
+     * @return Pointer to the root node of the subtree after rebalancing.
+     */
+    node<T>* Insert(node<T>* parent, node<T>* fresh);
+
+    /**
+     * @brief Helper function to link a new node into the BST and reset the parent link of the root.
+     * @param fresh Pointer to the new node.
+     */
+    void Link(node<T>* fresh);
+
+    /**
+     * @brief Helper function to get the height of a subtree.
+     * @param parent Pointer to the root node of the subtree, may be nullptr.
+     * @return The height of the subtree, 0 for nullptr.
+     */
+    static int Height(const node<T>* parent);
+
+    /**
+     * @brief Helper function to recompute the height and size of a node from those of its children and link the
+     * children back to it.
+     * @param parent Pointer to the node.
+     */
+    static void UpdateNode(node<T>* parent);
+
+    /**
+     * @brief Helper function to rotate a subtree to the left.
+     * @param parent Pointer to the root node of the subtree, which must have a right child.
+     * @return Pointer to the new root node of the subtree.
+     */
+    static node<T>* RotateLeft(node<T>* parent);
+
+    /**
+     * @brief Helper function to rotate a subtree to the right.
+     * @param parent Pointer to the root node of the subtree, which must have a left child.
+     * @return Pointer to the new root node of the subtree.
+     */
+    static node<T>* RotateRight(node<T>* parent);
+
+    /**
+     * @brief Helper function to restore the AVL balance of a node whose subtrees differ in height by at most two.
+     * @param parent Pointer to the root node of the subtree.
+     * @return Pointer to the new root node of the subtree.
+     */
+    static node<T>* Rebalance(node<T>* parent);
+
+    /**
+     * @brief Helper function to find the smallest value of a subtree.
+     * @param parent Pointer to the root node of the subtree, may be nullptr.
+     * @return Pointer to the leftmost node of the subtree, nullptr for an empty subtree.
      */
-    void Insert(node<T>* parent, T &data);
+    static node<T>* Minimum(node<T>* parent);
+
+    /**
+     * @brief Helper function to find the largest value of a subtree.
+     * @param parent Pointer to the root node of the subtree, may be nullptr.
+     * @return Pointer to the rightmost node of the subtree, nullptr for an empty subtree.
+     */
+    static node<T>* Maximum(node<T>* parent);
+
+    /**
+     * @brief Helper function to find the next node in order, by following the parent links.
+     * @param current Pointer to a node.
+     * @return Pointer to the node of the next larger value, nullptr if current holds the largest value.
+     */
+    static node<T>* Successor(node<T>* current);
+
+    /**
+     * @brief Helper function to find the previous node in order, by following the parent links.
+     * @param current Pointer to a node.
+     * @return Pointer to the node of the next smaller value, nullptr if current holds the smallest value.
+     */
+    static node<T>* Predecessor(node<T>* current);
+
+    /**
+     * @brief Helper function to find the first node of a subtree in post-order.
+     * @param parent Pointer to the root node of the subtree, may be nullptr.
+     * @return Pointer to the deepest node reached by preferring left children, nullptr for an empty subtree.
+     */
+    static node<T>* FirstPostOrder(node<T>* parent);
 
     /**
      * @brief Helper function to perform in-order traversal of the BST starting from a given node and apply a callback function.
@@ -159,11 +510,42 @@ private:
     void PostOrder(node<T>* parent, void(*fptr)(T&));
 
     /**
-     * @brief Helper function to delete the entire BST starting from a given node.
+     * @brief Helper function to destroy and deallocate the nodes of the BST starting from a given node.
      * @param parent Pointer to the root node of the subtree.
      */
     void DeleteTree(node<T>* &parent);
 
+    /**
+     * @brief Helper function to allocate and construct a node.
+     * @param args The arguments passed to the constructor of the data of the node.
+     * @return Pointer to the new leaf node.
+     */
+    template <typename... Args>
+    node<T>* NewNode(Args&&... args);
+
+    /**
+     * @brief Helper function to destroy and deallocate a single node.
+     * @param current Pointer to the node.
+     */
+    void DestroyNode(node<T>* current);
+
+    /**
+     * @brief Helper function to append the distinct values of the BST starting from a given node, in order.
+     * @param parent Pointer to the root node of the subtree.
+     * @param values The vector receiving the values.
+     */
+    static void CollectValues(const node<T>* parent, std::vector<T>& values);
+
+    /**
+     * @brief Helper function to build a perfectly balanced subtree from distinct sorted values.
+     * @param values The distinct values, in increasing order.
+     * @param occurrences The number of occurrences of each value.
+     * @param first Index of the first value of the subtree.
+     * @param last Index one past the last value of the subtree.
+     * @return Pointer to the root node of the subtree, nullptr if it is empty.
+     */
+    node<T>* BuildBalanced(const std::vector<T>& values, const std::vector<int>& occurrences, std::size_t first, std::size_t last);
+
     /**
      * @brief Helper function to search for a specific data element in the BST starting from a given node.
      * @param parent Pointer to the root node of the subtree.
@@ -178,31 +560,94 @@ private:
      * @param thatTree Pointer to the root node of the BST to be copied.
      */
     void Copy(node<T>* &thisTree, node<T>* thatTree);
-
-    /**
-     * @brief Helper function to perform post-order traversal of the BST starting from a given node and delete nodes.
-     * @param parent Pointer to the root node of the subtree.
-     */
-    void Destruct(node<T>* parent);
 };
 
-template <class T>
-int BST<T>::size()
+template <class T, class Allocator>
+int BST<T, Allocator>::size() const
 {
     return size(root);
 }
 
-template <class T>
-int BST<T>::size(node<T>* parent)
+template <class T, class Allocator>
+int BST<T, Allocator>::size(const node<T>* parent)
 {
-    if (parent == nullptr)
-        return 0;
-    else
-        return(size(parent->left) + 1 + size(parent->right));
+    return parent == nullptr ? 0 : parent->count;
+}
+
+template <class T, class Allocator>
+const T& BST<T, Allocator>::Select(int k) const
+{
+    const node<T>* current = root;
+    while (current != nullptr)
+    {
+        int leftSize = size(current->left);
+        if (k < leftSize)
+        {
+            current = current->left;
+        }
+        else if (k < leftSize + current->occurrences)
+        {
+            break;
+        }
+        else
+        {
+            k -= leftSize + current->occurrences;
+            current = current->right;
+        }
+    }
+    return current->data;
 }
 
-template <class T>
-BST<T>::BST(const BST<T>& thatTree)
+template <class T, class Allocator>
+int BST<T, Allocator>::Rank(const T& data) const
+{
+    int rank = 0;
+    const node<T>* current = root;
+    while (current != nullptr)
+    {
+        if (data > current->data)
+        {
+            rank += size(current->left) + current->occurrences;
+            current = current->right;
+        }
+        else
+        {
+            current = current->left;
+        }
+    }
+    return rank;
+}
+
+template <class T, class Allocator>
+double BST<T, Allocator>::Median() const
+{
+    return Percentile(50.0);
+}
+
+template <class T, class Allocator>
+double BST<T, Allocator>::Percentile(double p) const
+{
+    int count = size();
+    if (count == 0)
+        return 0.0;
+
+    if (p < 0.0)
+        p = 0.0;
+    if (p > 100.0)
+        p = 100.0;
+
+    double position = p / 100.0 * (count - 1);
+    int lower = static_cast<int>(position);
+    double fraction = position - lower;
+    double value = static_cast<double>(Select(lower));
+    if (fraction > 0.0 && lower + 1 < count)
+        value += fraction * (static_cast<double>(Select(lower + 1)) - value);
+    return value;
+}
+
+template <class T, class Allocator>
+BST<T, Allocator>::BST(const BST<T, Allocator>& thatTree)
+    : root(nullptr), multiset(thatTree.multiset)
 {
     if(thatTree.root == nullptr)
     {
@@ -214,25 +659,33 @@ BST<T>::BST(const BST<T>& thatTree)
     }
 }
 
-template <class T>
-void BST<T>::Copy(node<T>* &thisTree, node<T>* thatTree)
+template <class T, class Allocator>
+void BST<T, Allocator>::Copy(node<T>* &thisTree, node<T>* thatTree)
 {
     if(thatTree == nullptr)
         thisTree  = nullptr;
     else
     {
-        thisTree = new node<T>;
-        thisTree->data = thatTree->data;
+        thisTree = NewNode(thatTree->data);
+        thisTree->height = thatTree->height;
+        thisTree->count = thatTree->count;
+        thisTree->occurrences = thatTree->occurrences;
         Copy(thisTree->left, thatTree->left);
         Copy(thisTree->right, thatTree->right);
+        if(thisTree->left != nullptr)
+            thisTree->left->parent = thisTree;
+        if(thisTree->right != nullptr)
+            thisTree->right->parent = thisTree;
     }
 }
 
-template <class T>
-BST<T>& BST<T>::operator=(const BST<T>& that)
+template <class T, class Allocator>
+BST<T, Allocator>& BST<T, Allocator>::operator=(const BST<T, Allocator>& that)
 {
     if(this != &that)
     {
+        DeleteTree();
+        multiset = that.multiset;
         if(that.root == nullptr)
         {
             root = nullptr;
@@ -243,199 +696,448 @@ BST<T>& BST<T>::operator=(const BST<T>& that)
     return *this;
 }
 
-template <class T>
-BST<T>::~BST()
+template <class T, class Allocator>
+BST<T, Allocator>::~BST()
 {
-    if(root != nullptr)
-    {
-        Destruct(root);
-    }
+    DeleteTree();
 }
 
-template <class T>
-void BST<T>::Destruct(node<T>* parent)
+template <class T, class Allocator>
+template <typename InputIterator>
+void BST<T, Allocator>::BuildFromSorted(InputIterator begin, InputIterator end)
 {
-    if(parent != nullptr)
+    DeleteTree();
+
+    // Runs of equal values become one node, counted in a multiset and kept once otherwise.
+    std::vector<T> values;
+    std::vector<int> occurrences;
+    for (InputIterator current = begin; current != end; ++current)
     {
-        if( (parent->left == nullptr) && (parent->right == nullptr) )
+        if (!values.empty() && !(values.back() < *current))
         {
-            delete parent;
-            parent = nullptr;
+            if (multiset)
+                occurrences.back()++;
         }
         else
         {
-            Destruct(parent->left);
-            Destruct(parent->right);
+            values.push_back(*current);
+            occurrences.push_back(1);
         }
     }
+
+    root = BuildBalanced(values, occurrences, 0, values.size());
+    if(root != nullptr)
+        root->parent = nullptr;
 }
 
-template<typename T>
-BST<T>::BST()
-    : root(nullptr)
+template <class T, class Allocator>
+template <typename InputIterator>
+void BST<T, Allocator>::Build(InputIterator begin, InputIterator end)
 {
+    std::vector<T> sorted(begin, end);
+    std::sort(sorted.begin(), sorted.end());
+    BuildFromSorted(sorted.begin(), sorted.end());
+}
 
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::BuildBalanced(const std::vector<T>& values, const std::vector<int>& occurrences, std::size_t first, std::size_t last)
+{
+    if(first == last)
+        return nullptr;
+
+    std::size_t middle = first + (last - first) / 2;
+    node<T>* parent = NewNode(values[middle]);
+    parent->occurrences = occurrences[middle];
+    parent->left = BuildBalanced(values, occurrences, first, middle);
+    parent->right = BuildBalanced(values, occurrences, middle + 1, last);
+    UpdateNode(parent);
+    return parent;
+}
+
+template <class T, class Allocator>
+FrozenBST<T> BST<T, Allocator>::Freeze() const
+{
+    std::vector<T> values;
+    values.reserve(size());
+    CollectValues(root, values);
+    return FrozenBST<T>(values);
 }
 
-template <class T>
-void BST<T>::Insert(T &data)
+template <class T, class Allocator>
+void BST<T, Allocator>::CollectValues(const node<T>* parent, std::vector<T>& values)
 {
-    if(root == nullptr)
+    if(parent != nullptr)
     {
-        node<T>* temp = new node<T>;
-        temp->data = data;
-        temp->left = temp->right = nullptr;
-        root = temp;
+        CollectValues(parent->left, values);
+        values.push_back(parent->data);
+        CollectValues(parent->right, values);
     }
-    else
+}
+
+template <class T, class Allocator>
+template <typename... Args>
+node<T>* BST<T, Allocator>::NewNode(Args&&... args)
+{
+    return new (allocator.Allocate()) node<T>(std::in_place, std::forward<Args>(args)...);
+}
+
+template <class T, class Allocator>
+void BST<T, Allocator>::DestroyNode(node<T>* current)
+{
+    current->~node<T>();
+    allocator.Deallocate(current);
+}
+
+template <class T, class Allocator>
+BST<T, Allocator>::BST(BST<T, Allocator>&& thatTree) noexcept
+    : root(thatTree.root), allocator(std::move(thatTree.allocator)), multiset(thatTree.multiset)
+{
+    thatTree.root = nullptr;
+}
+
+template <class T, class Allocator>
+BST<T, Allocator>& BST<T, Allocator>::operator=(BST<T, Allocator>&& that) noexcept
+{
+    if(this != &that)
     {
-        Insert(root, data);
+        DeleteTree();
+        root = that.root;
+        allocator = std::move(that.allocator);
+        multiset = that.multiset;
+        that.root = nullptr;
     }
+    return *this;
+}
+
+template <class T, class Allocator>
+BST<T, Allocator>::BST(bool isMultiset)
+    : root(nullptr), multiset(isMultiset)
+{
+
+}
+
+template <class T, class Allocator>
+bool BST<T, Allocator>::IsMultiset() const
+{
+    return multiset;
+}
+
+template <class T, class Allocator>
+void BST<T, Allocator>::Insert(T &data)
+{
+    Link(NewNode(data));
+}
+
+template <class T, class Allocator>
+void BST<T, Allocator>::Insert(T &&data)
+{
+    Link(NewNode(std::move(data)));
+}
+
+template <class T, class Allocator>
+template <typename... Args>
+void BST<T, Allocator>::Emplace(Args&&... args)
+{
+    Link(NewNode(std::forward<Args>(args)...));
+}
+
+template <class T, class Allocator>
+void BST<T, Allocator>::Link(node<T>* fresh)
+{
+    root = Insert(root, fresh);
+    root->parent = nullptr;
 }
 
-template <class T>
-void BST<T>::Insert(node<T>* parent, T &data)
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::Insert(node<T>* parent, node<T>* fresh)
 {
-    if(data < parent->data)
+    if(parent == nullptr)
     {
-        if(parent->left == nullptr)
-        {
-            node<T>* temp = new node<T>;
-            temp->data = data;
-            temp->left = temp->right = nullptr;
-            parent->left = temp;
-        }
-        else
-        {
-            Insert(parent->left, data);
-        }
+        return fresh;
+    }
+
+    if(fresh->data < parent->data)
+    {
+        parent->left = Insert(parent->left, fresh);
+    }
+    else if(fresh->data > parent->data)
+    {
+        parent->right = Insert(parent->right, fresh);
     }
     else
     {
-        if(data > parent->data)
+        if(multiset)
         {
-            if(parent->right == nullptr)
-            {
-                node<T>* temp = new node<T>;
-                temp->data = data;
-                temp->right = temp->left = nullptr;
-                parent->right = temp;
-            }
-            else
-            {
-                Insert(parent->right, data);
-            }
+            parent->occurrences++;
+            parent->count++;
         }
+        DestroyNode(fresh);
+        return parent;
     }
+
+    return Rebalance(parent);
 }
 
-template <class T>
-void BST<T>::InOrder(void(*fptr)(T&))
+template <class T, class Allocator>
+int BST<T, Allocator>::Height() const
 {
-    if (root == nullptr)
-        return;
+    return Height(root);
+}
 
-    std::stack<node<T>*> nodesStack;
-    node<T>* current = root;
+template <class T, class Allocator>
+int BST<T, Allocator>::Height(const node<T>* parent)
+{
+    return parent == nullptr ? 0 : parent->height;
+}
 
-    while (!nodesStack.empty() || current != nullptr)
+template <class T, class Allocator>
+void BST<T, Allocator>::UpdateNode(node<T>* parent)
+{
+    int leftHeight = Height(parent->left);
+    int rightHeight = Height(parent->right);
+    parent->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+    parent->count = size(parent->left) + parent->occurrences + size(parent->right);
+    if(parent->left != nullptr)
+        parent->left->parent = parent;
+    if(parent->right != nullptr)
+        parent->right->parent = parent;
+}
+
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::RotateLeft(node<T>* parent)
+{
+    node<T>* pivot = parent->right;
+    parent->right = pivot->left;
+    pivot->left = parent;
+    UpdateNode(parent);
+    UpdateNode(pivot);
+    return pivot;
+}
+
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::RotateRight(node<T>* parent)
+{
+    node<T>* pivot = parent->left;
+    parent->left = pivot->right;
+    pivot->right = parent;
+    UpdateNode(parent);
+    UpdateNode(pivot);
+    return pivot;
+}
+
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::Rebalance(node<T>* parent)
+{
+    UpdateNode(parent);
+    int balance = Height(parent->left) - Height(parent->right);
+
+    if(balance > 1)
     {
-        if (current != nullptr)
+        // Left-right case: straighten the left subtree first.
+        if(Height(parent->left->left) < Height(parent->left->right))
+            parent->left = RotateLeft(parent->left);
+        return RotateRight(parent);
+    }
+    if(balance < -1)
+    {
+        // Right-left case: straighten the right subtree first.
+        if(Height(parent->right->right) < Height(parent->right->left))
+            parent->right = RotateRight(parent->right);
+        return RotateLeft(parent);
+    }
+
+    return parent;
+}
+
+template <class T, class Allocator>
+void BST<T, Allocator>::InOrder(void(*fptr)(T&))
+{
+    for (node<T>* current = Minimum(root); current != nullptr; current = Successor(current))
+    {
+        for (int i = 0; i < current->occurrences; i++)
+            fptr(current->data);
+    }
+}
+
+template <class T, class Allocator>
+void BST<T, Allocator>::PreOrder(void(*fptr)(T&))
+{
+    node<T>* current = root;
+    while (current != nullptr)
+    {
+        for (int i = 0; i < current->occurrences; i++)
+            fptr(current->data);
+
+        if (current->left != nullptr)
         {
-            nodesStack.push(current);
             current = current->left;
         }
-        else
+        else if (current->right != nullptr)
         {
-            current = nodesStack.top();
-            nodesStack.pop();
-            fptr(current->data);
             current = current->right;
         }
+        else
+        {
+            // Climb until a right subtree that has not been visited yet.
+            while (current->parent != nullptr && (current == current->parent->right || current->parent->right == nullptr))
+                current = current->parent;
+            current = current->parent != nullptr ? current->parent->right : nullptr;
+        }
     }
 }
 
-template <class T>
-void BST<T>::PreOrder(void(*fptr)(T&))
+template <class T, class Allocator>
+void BST<T, Allocator>::PostOrder(void(*fptr)(T&))
 {
-    if (root == nullptr)
-        return;
-
-    std::stack<node<T>*> nodesStack;
-    nodesStack.push(root);
-
-    while (!nodesStack.empty())
+    node<T>* current = FirstPostOrder(root);
+    while (current != nullptr)
     {
-        node<T>* current = nodesStack.top();
-        nodesStack.pop();
+        for (int i = 0; i < current->occurrences; i++)
+            fptr(current->data);
 
-        fptr(current->data);
+        node<T>* parent = current->parent;
+        if (parent != nullptr && current == parent->left && parent->right != nullptr)
+            current = FirstPostOrder(parent->right);
+        else
+            current = parent;
+    }
+}
 
-        if (current->right)
-            nodesStack.push(current->right);
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::Minimum(node<T>* parent)
+{
+    while (parent != nullptr && parent->left != nullptr)
+        parent = parent->left;
+    return parent;
+}
 
-        if (current->left)
-            nodesStack.push(current->left);
-    }
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::Maximum(node<T>* parent)
+{
+    while (parent != nullptr && parent->right != nullptr)
+        parent = parent->right;
+    return parent;
 }
 
-template <class T>
-void BST<T>::PostOrder(void(*fptr)(T&))
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::Successor(node<T>* current)
 {
-    if (root == nullptr)
-        return;
+    if (current->right != nullptr)
+        return Minimum(current->right);
 
-    std::stack<node<T>*> nodesStack1;
-    std::stack<node<T>*> nodesStack2;
+    while (current->parent != nullptr && current == current->parent->right)
+        current = current->parent;
+    return current->parent;
+}
 
-    nodesStack1.push(root);
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::Predecessor(node<T>* current)
+{
+    if (current->left != nullptr)
+        return Maximum(current->left);
 
-    while (!nodesStack1.empty())
-    {
-        node<T>* current = nodesStack1.top();
-        nodesStack1.pop();
+    while (current->parent != nullptr && current == current->parent->left)
+        current = current->parent;
+    return current->parent;
+}
 
-        nodesStack2.push(current);
+template <class T, class Allocator>
+node<T>* BST<T, Allocator>::FirstPostOrder(node<T>* parent)
+{
+    while (parent != nullptr && (parent->left != nullptr || parent->right != nullptr))
+        parent = parent->left != nullptr ? parent->left : parent->right;
+    return parent;
+}
 
-        if (current->left)
-            nodesStack1.push(current->left);
+template <class T, class Allocator>
+typename BST<T, Allocator>::Iterator BST<T, Allocator>::begin() const
+{
+    return Iterator(Minimum(root), root);
+}
 
-        if (current->right)
-            nodesStack1.push(current->right);
+template <class T, class Allocator>
+typename BST<T, Allocator>::Iterator BST<T, Allocator>::end() const
+{
+    return Iterator(nullptr, root);
+}
+
+template <class T, class Allocator>
+typename BST<T, Allocator>::Iterator BST<T, Allocator>::LowerBound(const T& data) const
+{
+    node<T>* bound = nullptr;
+    node<T>* current = root;
+    while (current != nullptr)
+    {
+        if (current->data < data)
+        {
+            current = current->right;
+        }
+        else
+        {
+            bound = current;
+            current = current->left;
+        }
     }
+    return Iterator(bound, root);
+}
 
-    while (!nodesStack2.empty())
+template <class T, class Allocator>
+typename BST<T, Allocator>::Iterator BST<T, Allocator>::UpperBound(const T& data) const
+{
+    node<T>* bound = nullptr;
+    node<T>* current = root;
+    while (current != nullptr)
     {
-        node<T>* current = nodesStack2.top();
-        nodesStack2.pop();
+        if (data < current->data)
+        {
+            bound = current;
+            current = current->left;
+        }
+        else
+        {
+            current = current->right;
+        }
+    }
+    return Iterator(bound, root);
+}
 
-        fptr(current->data);
+template <class T, class Allocator>
+template <typename Callback>
+void BST<T, Allocator>::ForEachInRange(const T& low, const T& high, Callback callback) const
+{
+    for (Iterator position = LowerBound(low); position != end() && !(high < *position); ++position)
+    {
+        for (int i = 0; i < position.Occurrences(); i++)
+            callback(*position);
     }
 }
 
-template <class T>
-void BST<T>::DeleteTree()
+template <class T, class Allocator>
+void BST<T, Allocator>::DeleteTree()
 {
-    if(root != nullptr)
+    // Nodes of trivially destructible data need no destructor calls, so the allocator releases them all at once.
+    if constexpr (!std::is_trivially_destructible<T>::value)
     {
         DeleteTree(root);
     }
+    root = nullptr;
+    allocator.Clear();
 }
 
-template <class T>
-void BST<T>::DeleteTree(node<T>* &parent)
+template <class T, class Allocator>
+void BST<T, Allocator>::DeleteTree(node<T>* &parent)
 {
     if (parent != nullptr)
     {
         DeleteTree(parent->left);
         DeleteTree(parent->right);
-        delete parent;
+        DestroyNode(parent);
         parent = nullptr;
     }
 }
 
-template <class T>
-bool BST<T>::Search(T &data)
+template <class T, class Allocator>
+bool BST<T, Allocator>::Search(T &data)
 {
     if (root != nullptr)
     {
@@ -454,25 +1156,43 @@ bool BST<T>::Search(T &data)
         return false;
     }
 }
-template <class T>
+template <class T, class Allocator>
 template <typename Callback>
-void BST<T>::InOrder(Callback callback)
+void BST<T, Allocator>::InOrder(Callback callback)
 {
     InOrder(root, callback);
 }
-template <class T>
+template <class T, class Allocator>
 template <typename Callback>
-void BST<T>::InOrder(node<T>* parent, Callback callback)
+void BST<T, Allocator>::InOrder(node<T>* parent, Callback callback)
 {
     if(parent != nullptr)
     {
         InOrder(parent->left, callback);
-        callback(parent->data);
+        for (int i = 0; i < parent->occurrences; i++)
+            callback(parent->data);
         InOrder(parent->right, callback);
     }
 }
-template <class T>
-bool BST<T>::Search(node<T>* &parent,T &data)
+template <class T, class Allocator>
+template <typename Callback>
+void BST<T, Allocator>::InOrderCounted(Callback callback)
+{
+    InOrderCounted(root, callback);
+}
+template <class T, class Allocator>
+template <typename Callback>
+void BST<T, Allocator>::InOrderCounted(node<T>* parent, Callback callback)
+{
+    if(parent != nullptr)
+    {
+        InOrderCounted(parent->left, callback);
+        callback(parent->data, parent->occurrences);
+        InOrderCounted(parent->right, callback);
+    }
+}
+template <class T, class Allocator>
+bool BST<T, Allocator>::Search(node<T>* &parent,T &data)
 {
     if(parent!=nullptr)
     {
@@ -0,0 +1,168 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <algorithm>
+
+#include "BST.h"
+
+// Insert and search as they were done by BST before it was balanced, kept here as the baseline.
+// The loops are iterative so that degenerate trees do not overflow the stack.
+struct UnbalancedTree
+{
+    struct Node
+    {
+        int data;
+        Node* left;
+        Node* right;
+    };
+
+    std::vector<Node*> nodes;
+    Node* root = nullptr;
+
+    ~UnbalancedTree()
+    {
+        for (Node* n : nodes)
+            delete n;
+    }
+
+    void Insert(int data)
+    {
+        Node** link = &root;
+        while (*link != nullptr)
+        {
+            if (data < (*link)->data)
+                link = &(*link)->left;
+            else if (data > (*link)->data)
+                link = &(*link)->right;
+            else
+                return;
+        }
+        *link = new Node{data, nullptr, nullptr};
+        nodes.push_back(*link);
+    }
+
+    bool Search(int data) const
+    {
+        const Node* current = root;
+        while (current != nullptr && current->data != data)
+            current = data < current->data ? current->left : current->right;
+        return current != nullptr;
+    }
+
+    int Height() const
+    {
+        int height = 0;
+        std::vector<std::pair<const Node*, int>> pending;
+        if (root != nullptr)
+            pending.push_back(std::make_pair(root, 1));
+        while (!pending.empty())
+        {
+            std::pair<const Node*, int> top = pending.back();
+            pending.pop_back();
+            height = std::max(height, top.second);
+            if (top.first->left != nullptr)
+                pending.push_back(std::make_pair(top.first->left, top.second + 1));
+            if (top.first->right != nullptr)
+                pending.push_back(std::make_pair(top.first->right, top.second + 1));
+        }
+        return height;
+    }
+};
+
+template <typename Function>
+double TimeRun(Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void BenchmarkOrder(const std::string& name, std::vector<int> keys)
+{
+    std::cout << "-- " << name << " insertion order: " << keys.size() << " keys --\n";
+    UnbalancedTree unbalanced;
+    BST<int> balanced;
+    std::size_t unbalancedFound = 0;
+    std::size_t balancedFound = 0;
+
+    double unbalancedInsert = TimeRun([&]()
+    {
+        for (int key : keys)
+            unbalanced.Insert(key);
+    });
+    double balancedInsert = TimeRun([&]()
+    {
+        for (int& key : keys)
+            balanced.Insert(key);
+    });
+    double unbalancedSearch = TimeRun([&]()
+    {
+        for (int key : keys)
+            unbalancedFound += unbalanced.Search(key);
+    });
+    double balancedSearch = TimeRun([&]()
+    {
+        for (int& key : keys)
+            balancedFound += balanced.Search(key);
+    });
+
+    std::cout << "Unbalanced: insert " << unbalancedInsert << " s, search " << unbalancedSearch << " s, height "
+              << unbalanced.Height() << " (found " << unbalancedFound << ")" << std::endl;
+    std::cout << "AVL:        insert " << balancedInsert << " s, search " << balancedSearch << " s, height "
+              << balanced.Height() << " (found " << balancedFound << ")" << std::endl;
+    std::cout << "Speed-up: insert " << unbalancedInsert / balancedInsert << "x, search "
+              << unbalancedSearch / balancedSearch << "x" << std::endl;
+}
+
+void BenchmarkBulkLoad(const std::vector<int>& sorted)
+{
+    std::cout << "-- Bulk load of " << sorted.size() << " sorted keys --\n";
+    BST<int> inserted;
+    BST<int> built;
+    std::vector<int> keys(sorted);
+
+    double insertTime = TimeRun([&]()
+    {
+        for (int& key : keys)
+            inserted.Insert(key);
+    });
+    double buildTime = TimeRun([&]()
+    {
+        built.BuildFromSorted(sorted.begin(), sorted.end());
+    });
+
+    std::cout << "Insert():          " << insertTime << " s, height " << inserted.Height() << std::endl;
+    std::cout << "BuildFromSorted(): " << buildTime << " s, height " << built.Height() << std::endl;
+    std::cout << "Speed-up: " << insertTime / buildTime << "x" << std::endl;
+}
+
+int main()
+{
+    // Kept small enough for the unbalanced baseline, which is quadratic on sorted input.
+    const int KeyCount = 20000;
+    std::srand(42);
+
+    std::vector<int> sorted(KeyCount);
+    for (int i = 0; i < KeyCount; ++i)
+        sorted[i] = i;
+    std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+    std::vector<int> random(sorted);
+    for (int i = KeyCount - 1; i > 0; --i)
+        std::swap(random[i], random[std::rand() % (i + 1)]);
+
+    BenchmarkOrder("Sorted", sorted);
+    std::cout << std::endl;
+    BenchmarkOrder("Reverse-sorted", reversed);
+    std::cout << std::endl;
+    BenchmarkOrder("Random", random);
+    std::cout << std::endl;
+
+    std::vector<int> large(1000000);
+    for (int i = 0; i < static_cast<int>(large.size()); ++i)
+        large[i] = i;
+    BenchmarkBulkLoad(large);
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BST.h"
+
+void TestInsertAndInOrder();
+void TestDuplicatesIgnored();
+void TestSortedInsertStaysBalanced();
+void TestSearch();
+void TestCopy();
+void TestOrderStatistics();
+void TestMultiset();
+void TestDeleteAndAssign();
+void TestBuildFromSorted();
+void TestIteratorsAndRanges();
+void TestMoveAndEmplace();
+
+void PrintValue(int& value)
+{
+    std::cout << value << " ";
+}
+
+void TestInsertAndInOrder()
+{
+    std::cout << "-- Testing Insert() and InOrder() --\n";
+    BST<int> tree;
+    int values[] = {50, 30, 70, 20, 40, 60, 80};
+    for (int& value : values)
+    {
+        tree.Insert(value);
+    }
+    std::cout << "InOrder: ";
+    tree.InOrder(PrintValue);
+    std::cout << std::endl;
+    std::cout << "PreOrder: ";
+    tree.PreOrder(PrintValue);
+    std::cout << std::endl;
+    std::cout << "Size: " << tree.size() << ", Height: " << tree.Height() << std::endl;
+}
+
+void TestDuplicatesIgnored()
+{
+    std::cout << "-- Testing Insert() With Duplicates --\n";
+    BST<int> tree;
+    int values[] = {5, 5, 3, 5, 3};
+    for (int& value : values)
+    {
+        tree.Insert(value);
+    }
+    std::cout << "Size: " << tree.size() << " (expected 2)" << std::endl;
+}
+
+void TestSortedInsertStaysBalanced()
+{
+    std::cout << "-- Testing Sorted and Reverse-Sorted Insert() --\n";
+    const int Count = 100000;
+    BST<int> ascending;
+    BST<int> descending;
+    for (int i = 0; i < Count; i++)
+    {
+        int up = i;
+        int down = Count - i;
+        ascending.Insert(up);
+        descending.Insert(down);
+    }
+    int limit = static_cast<int>(1.45 * std::log2(Count + 2.0));
+    std::cout << "Ascending height: " << ascending.Height() << " (limit " << limit << ")" << std::endl;
+    std::cout << "Descending height: " << descending.Height() << " (limit " << limit << ")" << std::endl;
+    std::cout << "Sizes: " << ascending.size() << ", " << descending.size() << std::endl;
+}
+
+void TestSearch()
+{
+    std::cout << "-- Testing Search() --\n";
+    BST<int> tree;
+    for (int i = 0; i < 100; i += 2)
+    {
+        tree.Insert(i);
+    }
+    int present = 42;
+    int absent = 43;
+    std::cout << "Search 42: " << (tree.Search(present) ? "Found" : "Not found") << std::endl;
+    std::cout << "Search 43: " << (tree.Search(absent) ? "Found" : "Not found") << std::endl;
+}
+
+void TestCopy()
+{
+    std::cout << "-- Testing Copy Constructor --\n";
+    BST<int> tree;
+    for (int i = 1; i <= 7; i++)
+    {
+        tree.Insert(i);
+    }
+    BST<int> copy(tree);
+    int extra = 8;
+    copy.Insert(extra);
+    std::cout << "Original: ";
+    tree.InOrder(PrintValue);
+    std::cout << "(height " << tree.Height() << ")" << std::endl;
+    std::cout << "Copy: ";
+    copy.InOrder(PrintValue);
+    std::cout << "(height " << copy.Height() << ")" << std::endl;
+}
+
+void TestOrderStatistics()
+{
+    std::cout << "-- Testing Select(), Rank(), Median() and Percentile() --\n";
+    BST<int> tree;
+    for (int i = 10; i >= 1; i--)
+    {
+        int value = i * 10;
+        tree.Insert(value);
+    }
+    std::cout << "Select(0): " << tree.Select(0) << ", Select(4): " << tree.Select(4) << ", Select(9): " << tree.Select(9) << std::endl;
+    std::cout << "Rank(10): " << tree.Rank(10) << ", Rank(55): " << tree.Rank(55) << ", Rank(1000): " << tree.Rank(1000) << std::endl;
+    std::cout << "Median: " << tree.Median() << " (expected 55)" << std::endl;
+    std::cout << "Percentile(0): " << tree.Percentile(0.0) << ", Percentile(95): " << tree.Percentile(95.0)
+              << " (expected 95.5), Percentile(100): " << tree.Percentile(100.0) << std::endl;
+
+    int extra = 110;
+    tree.Insert(extra);
+    std::cout << "Median after inserting 110: " << tree.Median() << " (expected 60)" << std::endl;
+
+    BST<int> empty;
+    std::cout << "Empty size: " << empty.size() << ", median: " << empty.Median() << std::endl;
+}
+
+void TestMultiset()
+{
+    std::cout << "-- Testing Multiset Insert() --\n";
+    BST<int> tree(true);
+    int values[] = {5, 5, 3, 5, 3, 9};
+    for (int& value : values)
+    {
+        tree.Insert(value);
+    }
+    std::cout << "Multiset: " << (tree.IsMultiset() ? "Yes" : "No") << std::endl;
+    std::cout << "Size: " << tree.size() << " (expected 6)" << std::endl;
+    std::cout << "InOrder: ";
+    tree.InOrder(PrintValue);
+    std::cout << std::endl;
+    std::cout << "InOrderCounted: ";
+    tree.InOrderCounted([](int& value, int count)
+    {
+        std::cout << value << "x" << count << " ";
+    });
+    std::cout << std::endl;
+    std::cout << "Select(2): " << tree.Select(2) << ", Rank(5): " << tree.Rank(5) << ", Rank(9): " << tree.Rank(9) << std::endl;
+    std::cout << "Median: " << tree.Median() << " (expected 5)" << std::endl;
+
+    BST<int> copy(tree);
+    std::cout << "Copy multiset: " << (copy.IsMultiset() ? "Yes" : "No") << ", size: " << copy.size() << std::endl;
+}
+
+void TestDeleteAndAssign()
+{
+    std::cout << "-- Testing DeleteTree() and Assignment Operator --\n";
+    BST<std::string> words;
+    std::string values[] = {"wind", "solar", "temperature"};
+    for (std::string& value : values)
+    {
+        words.Insert(value);
+    }
+    BST<std::string> copy;
+    copy = words;
+    words.DeleteTree();
+    std::cout << "Size after DeleteTree(): " << words.size() << std::endl;
+    std::cout << "Copy: ";
+    copy.InOrder([](std::string& value)
+    {
+        std::cout << value << " ";
+    });
+    std::cout << std::endl;
+
+    std::string extra = "humidity";
+    words.Insert(extra);
+    copy = words;
+    std::cout << "Copy after reassignment: " << copy.size() << " value(s)" << std::endl;
+}
+
+void TestBuildFromSorted()
+{
+    std::cout << "-- Testing BuildFromSorted() and Build() --\n";
+    std::vector<int> sorted;
+    for (int i = 1; i <= 1000; i++)
+    {
+        sorted.push_back(i);
+    }
+    BST<int> tree;
+    tree.BuildFromSorted(sorted.begin(), sorted.end());
+    std::cout << "Size: " << tree.size() << ", Height: " << tree.Height() << " (expected 10)" << std::endl;
+    std::cout << "Select(499): " << tree.Select(499) << ", Median: " << tree.Median() << std::endl;
+    int extra = 1001;
+    tree.Insert(extra);
+    std::cout << "Size after Insert(): " << tree.size() << ", Height: " << tree.Height() << std::endl;
+
+    int values[] = {7, 3, 7, 1, 3, 7};
+    BST<int> multiset(true);
+    multiset.Build(values, values + 6);
+    std::cout << "Multiset: ";
+    multiset.InOrderCounted([](int& value, int count)
+    {
+        std::cout << value << "x" << count << " ";
+    });
+    std::cout << "(size " << multiset.size() << ")" << std::endl;
+
+    BST<int> distinct;
+    distinct.Build(values, values + 6);
+    std::cout << "Set: ";
+    distinct.InOrder(PrintValue);
+    std::cout << "(size " << distinct.size() << ")" << std::endl;
+}
+
+void TestIteratorsAndRanges()
+{
+    std::cout << "-- Testing Iterator, LowerBound(), UpperBound() and ForEachInRange() --\n";
+    BST<int> tree(true);
+    int values[] = {40, 10, 60, 30, 20, 50, 70, 30};
+    for (int& value : values)
+    {
+        tree.Insert(value);
+    }
+
+    std::cout << "Forward: ";
+    for (BST<int>::Iterator position = tree.begin(); position != tree.end(); ++position)
+    {
+        std::cout << *position << "x" << position.Occurrences() << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "Backward: ";
+    BST<int>::Iterator position = tree.end();
+    while (position != tree.begin())
+    {
+        --position;
+        std::cout << *position << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "PostOrder: ";
+    tree.PostOrder(PrintValue);
+    std::cout << std::endl;
+
+    std::cout << "LowerBound(30): " << *tree.LowerBound(30) << ", LowerBound(35): " << *tree.LowerBound(35)
+              << ", UpperBound(30): " << *tree.UpperBound(30) << std::endl;
+    std::cout << "LowerBound(71) is end: " << (tree.LowerBound(71) == tree.end() ? "Yes" : "No") << std::endl;
+
+    std::cout << "Values in [25, 55]: ";
+    tree.ForEachInRange(25, 55, [](const int& value)
+    {
+        std::cout << value << " ";
+    });
+    std::cout << std::endl;
+
+    int visited = 0;
+    tree.ForEachInRange(41, 49, [&visited](const int&)
+    {
+        visited++;
+    });
+    std::cout << "Values in [41, 49]: " << visited << std::endl;
+}
+
+void TestMoveAndEmplace()
+{
+    std::cout << "-- Testing Move Semantics, Insert(T&&) and Emplace() --\n";
+    BST<std::string> words(true);
+    words.Emplace("wind");
+    words.Emplace(5, 's');
+    words.Insert(std::string("solar"));
+    words.Insert(std::string("wind"));
+    std::cout << "Words: ";
+    words.InOrderCounted([](std::string& value, int count)
+    {
+        std::cout << value << "x" << count << " ";
+    });
+    std::cout << "(size " << words.size() << ")" << std::endl;
+
+    BST<std::string> moved(std::move(words));
+    std::cout << "Moved tree size: " << moved.size() << ", source size: " << words.size()
+              << ", multiset: " << (moved.IsMultiset() ? "Yes" : "No") << std::endl;
+
+    BST<std::string> assigned;
+    assigned.Emplace("temperature");
+    assigned = std::move(moved);
+    std::cout << "Move-assigned tree: ";
+    for (const std::string& value : assigned)
+    {
+        std::cout << value << " ";
+    }
+    std::cout << "(source size " << moved.size() << ")" << std::endl;
+
+    words.Emplace("humidity");
+    std::cout << "Moved-from tree after Emplace(): " << words.size() << " value(s)" << std::endl;
+}
+
+int main()
+{
+    TestInsertAndInOrder();
+    std::cout << std::endl;
+    TestDuplicatesIgnored();
+    std::cout << std::endl;
+    TestSortedInsertStaysBalanced();
+    std::cout << std::endl;
+    TestSearch();
+    std::cout << std::endl;
+    TestCopy();
+    std::cout << std::endl;
+    TestOrderStatistics();
+    std::cout << std::endl;
+    TestMultiset();
+    std::cout << std::endl;
+    TestDeleteAndAssign();
+    std::cout << std::endl;
+    TestBuildFromSorted();
+    std::cout << std::endl;
+    TestIteratorsAndRanges();
+    std::cout << std::endl;
+    TestMoveAndEmplace();
+
+    return 0;
+}
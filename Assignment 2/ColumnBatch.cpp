@@ -0,0 +1,40 @@
+#include "ColumnBatch.h"
+
+ColumnBatch::ColumnBatch() : invalidValues(0)
+{
+}
+
+std::size_t ColumnBatch::Size() const
+{
+    return timestamps.size();
+}
+
+void ColumnBatch::Reserve(std::size_t rows)
+{
+    timestamps.reserve(rows);
+    windSpeeds.reserve(rows);
+    solarRadiations.reserve(rows);
+    temperatures.reserve(rows);
+}
+
+void ColumnBatch::Clear()
+{
+    timestamps.clear();
+    windSpeeds.clear();
+    solarRadiations.clear();
+    temperatures.clear();
+    invalidValues = 0;
+}
+
+void ColumnBatch::Append(Timestamp timestamp, float windSpeed, float solarRadiation, float temperature)
+{
+    timestamps.push_back(timestamp);
+    windSpeeds.push_back(windSpeed);
+    solarRadiations.push_back(solarRadiation);
+    temperatures.push_back(temperature);
+}
+
+WeatherLog ColumnBatch::GetLog(std::size_t index) const
+{
+    return WeatherLog(timestamps[index].GetDate(), timestamps[index].GetTime(), static_cast<int>(windSpeeds[index]), temperatures[index], solarRadiations[index]);
+}
@@ -0,0 +1,87 @@
+#include "ColumnPlan.h"
+
+#include <algorithm>
+
+namespace
+{
+    const std::size_t NotFound = ColumnPlan::MaxColumns;
+
+    // Removes surrounding blanks, quotes, carriage returns and a UTF-8 byte order mark from a header name.
+    std::string_view TrimName(std::string_view name)
+    {
+        if (name.size() >= 3 && name.substr(0, 3) == "\xEF\xBB\xBF")
+            name.remove_prefix(3);
+
+        const char* blanks = " \t\r\n\"";
+        std::size_t first = name.find_first_not_of(blanks);
+        if (first == std::string_view::npos)
+            return std::string_view();
+
+        std::size_t last = name.find_last_not_of(blanks);
+        return name.substr(first, last - first + 1);
+    }
+}
+
+ColumnPlan::ColumnPlan()
+    : m_timestampColumn(0), m_windSpeedColumn(10), m_solarRadiationColumn(11), m_temperatureColumn(17), m_lastColumn(17)
+{
+}
+
+bool ColumnPlan::Compile(std::string_view header)
+{
+    std::size_t timestamp = NotFound;
+    std::size_t windSpeed = NotFound;
+    std::size_t solarRadiation = NotFound;
+    std::size_t temperature = NotFound;
+
+    for (std::size_t column = 0; column < MaxColumns && !header.empty(); column++)
+    {
+        std::size_t pos = header.find(',');
+        std::string_view name = TrimName(header.substr(0, pos));
+        header.remove_prefix(pos == std::string_view::npos ? header.size() : pos + 1);
+
+        if (name == "WAST")
+            timestamp = column;
+        else if (name == "S")
+            windSpeed = column;
+        else if (name == "SR")
+            solarRadiation = column;
+        else if (name == "T")
+            temperature = column;
+    }
+
+    if (timestamp == NotFound || windSpeed == NotFound || solarRadiation == NotFound || temperature == NotFound)
+        return false;
+
+    m_timestampColumn = timestamp;
+    m_windSpeedColumn = windSpeed;
+    m_solarRadiationColumn = solarRadiation;
+    m_temperatureColumn = temperature;
+    m_lastColumn = std::max(std::max(timestamp, windSpeed), std::max(solarRadiation, temperature));
+    return true;
+}
+
+std::size_t ColumnPlan::GetTimestampColumn() const
+{
+    return m_timestampColumn;
+}
+
+std::size_t ColumnPlan::GetWindSpeedColumn() const
+{
+    return m_windSpeedColumn;
+}
+
+std::size_t ColumnPlan::GetSolarRadiationColumn() const
+{
+    return m_solarRadiationColumn;
+}
+
+std::size_t ColumnPlan::GetTemperatureColumn() const
+{
+    return m_temperatureColumn;
+}
+
+std::size_t ColumnPlan::GetLastColumn() const
+{
+    return m_lastColumn;
+}
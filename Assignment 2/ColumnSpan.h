@@ -0,0 +1,99 @@
+// ColumnSpan.h
+
+/**
+ * @class ColumnSpan
+ * @brief A read-only view of a contiguous range of column values.
+ *
+ * The ColumnSpan class refers to values stored contiguously by another container, such as one column of a
+ * WeatherStore. It does not own the values and stays valid only while the container is not modified.
+ *
+ * @details The class offers indexed access and begin()/end() iterators, so a span can be used in range-based
+ * for loops and with the standard algorithms. Subspan() narrows the view without copying.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef COLUMNSPAN_H
+#define COLUMNSPAN_H
+
+#include <cstddef>
+
+template <typename T>
+class ColumnSpan
+{
+public:
+    /**
+     * @brief Default constructor for the ColumnSpan class. Creates an empty span.
+     */
+    ColumnSpan() : m_data(nullptr), m_size(0)
+    {
+    }
+
+    /**
+     * @brief Constructs a span over a range of values.
+     * @param data Pointer to the first value.
+     * @param size The number of values.
+     */
+    ColumnSpan(const T* data, std::size_t size) : m_data(data), m_size(size)
+    {
+    }
+
+    /**
+     * @brief Gets the number of values in the span.
+     * @return The size of the span.
+     */
+    std::size_t Size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief Checks if the span is empty.
+     * @return True if the span has no values, false otherwise.
+     */
+    bool IsEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * @brief Accesses the value at the specified index.
+     * @param index The index of the value.
+     * @return Reference to the value.
+     */
+    const T& operator[](std::size_t index) const
+    {
+        return m_data[index];
+    }
+
+    /**
+     * @brief Creates a view of part of the span.
+     * @param offset The index of the first value of the new span.
+     * @param count The number of values in the new span.
+     * @return The narrower span.
+     */
+    ColumnSpan<T> Subspan(std::size_t offset, std::size_t count) const
+    {
+        return ColumnSpan<T>(m_data + offset, count);
+    }
+
+    const T* begin() const
+    {
+        return m_data;
+    }
+
+    const T* end() const
+    {
+        return m_data + m_size;
+    }
+
+private:
+    const T* m_data; ///< First value of the span.
+    std::size_t m_size; ///< Number of values in the span.
+};
+
+#endif // COLUMNSPAN_H
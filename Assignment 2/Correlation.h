@@ -0,0 +1,161 @@
+// Correlation.h
+
+/**
+ * @class Correlation
+ * @brief Single-pass accumulator for the Pearson correlation coefficients between three series of values.
+ *
+ * The Correlation class takes the three values of one reading at a time, such as the wind speed, temperature and
+ * solar radiation measured at the same timestamp, and keeps their means and co-moments. The sample Pearson
+ * correlation coefficient of any pair of the series can then be read in O(1), so the coefficients of all three
+ * pairs come from a single pass over the readings.
+ *
+ * @details The co-moment of series a and b is the sum over all readings of (a - mean of a) * (b - mean of b).
+ * Both the means and the co-moments are updated with the multivariate form of Welford's method, which avoids the
+ * cancellation of the textbook sum-of-products formula. The co-moment of a series with itself is its sum of
+ * squared deviations. Readings are paired by the order in which they are added, so the values passed to one call
+ * of Add() must belong to the same reading.
+ *
+ * Merge() combines two accumulators with the pairwise update of Chan et al., so the readings of separate windows
+ * can be correlated separately and then combined exactly.
+ *
+ * @note The coefficient is 0 when either series has no variation, including when fewer than two readings were
+ * added.
+ *
+ * @author Mohsin Ali Khan
+ * @version 02
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef CORRELATION_H
+#define CORRELATION_H
+
+#include <cmath>
+#include <cstddef>
+
+class Correlation
+{
+public:
+    static const int Series = 3; ///< Number of series accumulated together.
+
+    /**
+     * @brief Default constructor for the Correlation class. Creates an empty accumulator.
+     */
+    Correlation() : m_count(0), m_mean{0.0, 0.0, 0.0}, m_comoment{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}
+    {
+    }
+
+    /**
+     * @brief Adds the three values of one reading.
+     * @param first The value of series 0.
+     * @param second The value of series 1.
+     * @param third The value of series 2.
+     */
+    void Add(double first, double second, double third)
+    {
+        double values[Series] = {first, second, third};
+        double before[Series];
+        m_count++;
+        for (int i = 0; i < Series; i++)
+        {
+            before[i] = values[i] - m_mean[i];
+            m_mean[i] += before[i] / static_cast<double>(m_count);
+        }
+
+        // Pairs the deviation from the old mean of one series with the deviation from the new mean of the other.
+        for (int i = 0; i < Series; i++)
+        {
+            for (int j = i; j < Series; j++)
+            {
+                m_comoment[i][j] += before[i] * (values[j] - m_mean[j]);
+            }
+        }
+    }
+
+    /**
+     * @brief Adds every reading added to another accumulator.
+     * @param other The accumulator to be merged into this one.
+     */
+    void Merge(const Correlation& other)
+    {
+        if (other.m_count == 0)
+            return;
+        if (m_count == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        double count = static_cast<double>(m_count);
+        double otherCount = static_cast<double>(other.m_count);
+        double total = count + otherCount;
+        double delta[Series];
+        for (int i = 0; i < Series; i++)
+        {
+            delta[i] = other.m_mean[i] - m_mean[i];
+            m_mean[i] += delta[i] * otherCount / total;
+        }
+
+        for (int i = 0; i < Series; i++)
+        {
+            for (int j = i; j < Series; j++)
+            {
+                m_comoment[i][j] += other.m_comoment[i][j] + delta[i] * delta[j] * count * otherCount / total;
+            }
+        }
+        m_count += other.m_count;
+    }
+
+    /**
+     * @brief Gets the number of readings added.
+     * @return The count of readings.
+     */
+    std::size_t Count() const
+    {
+        return m_count;
+    }
+
+    /**
+     * @brief Gets the mean of one series.
+     * @param series The index of the series (0-2).
+     * @return The mean of the series.
+     */
+    double Mean(int series) const
+    {
+        return m_mean[series];
+    }
+
+    /**
+     * @brief Gets the co-moment of two series.
+     * @param a The index of the first series (0-2).
+     * @param b The index of the second series (0-2).
+     * @return The sum of the products of the deviations of the two series from their means.
+     */
+    double CoMoment(int a, int b) const
+    {
+        return a <= b ? m_comoment[a][b] : m_comoment[b][a];
+    }
+
+    /**
+     * @brief Gets the sample Pearson correlation coefficient of two series.
+     * @param a The index of the first series (0-2).
+     * @param b The index of the second series (0-2).
+     * @return The coefficient, between -1 and 1, or 0 if either series has no variation.
+     */
+    double Coefficient(int a, int b) const
+    {
+        double denominator = std::sqrt(CoMoment(a, a)) * std::sqrt(CoMoment(b, b));
+        if (denominator == 0.0)
+            return 0.0;
+
+        return CoMoment(a, b) / denominator;
+    }
+
+private:
+    std::size_t m_count; ///< Number of readings added.
+    double m_mean[Series]; ///< Running mean of each series.
+    double m_comoment[Series][Series]; ///< Running co-moment of each pair of series, upper triangle only.
+};
+
+#endif // CORRELATION_H
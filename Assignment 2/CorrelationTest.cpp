@@ -0,0 +1,123 @@
+#include <iostream>
+#include <cmath>
+
+#include "Correlation.h"
+
+void TestEmpty();
+void TestPerfectCorrelation();
+void TestAgainstTwoPass();
+void TestMerge();
+
+void TestEmpty()
+{
+    std::cout << "-- Testing Empty Accumulator --\n";
+    Correlation correlation;
+    std::cout << "Count: " << correlation.Count() << ", Coefficient(0, 1): " << correlation.Coefficient(0, 1) << std::endl;
+    correlation.Add(1.0, 2.0, 3.0);
+    std::cout << "One reading, Coefficient(0, 1): " << correlation.Coefficient(0, 1) << std::endl;
+}
+
+void TestPerfectCorrelation()
+{
+    std::cout << "-- Testing Perfectly Correlated Series --\n";
+    Correlation correlation;
+    for (int i = 0; i < 100; i++)
+    {
+        double x = i * 0.5;
+        correlation.Add(x, 3.0 * x - 7.0, 40.0 - x);
+    }
+    std::cout << "Coefficient(0, 1): " << correlation.Coefficient(0, 1) << " (expected 1)" << std::endl;
+    std::cout << "Coefficient(0, 2): " << correlation.Coefficient(0, 2) << " (expected -1)" << std::endl;
+    std::cout << "Coefficient(2, 1): " << correlation.Coefficient(2, 1) << " (expected -1)" << std::endl;
+    std::cout << "Coefficient(1, 1): " << correlation.Coefficient(1, 1) << " (expected 1)" << std::endl;
+    std::cout << "Mean(1): " << correlation.Mean(1) << " (expected 67.25)" << std::endl;
+}
+
+void TestAgainstTwoPass()
+{
+    std::cout << "-- Testing Against the Two-Pass Formula --\n";
+    const int count = 1000;
+    double a[count];
+    double b[count];
+    double c[count];
+    Correlation correlation;
+    for (int i = 0; i < count; i++)
+    {
+        a[i] = std::sin(i * 0.1) * 20.0 + 1000.0;
+        b[i] = std::cos(i * 0.07) * 5.0 + a[i] * 0.1;
+        c[i] = (i % 17) * 1.5;
+        correlation.Add(a[i], b[i], c[i]);
+    }
+
+    double* series[3] = {a, b, c};
+    bool allMatch = true;
+    for (int x = 0; x < 3; x++)
+    {
+        for (int y = 0; y < 3; y++)
+        {
+            double xMean = 0.0;
+            double yMean = 0.0;
+            for (int i = 0; i < count; i++)
+            {
+                xMean += series[x][i] / count;
+                yMean += series[y][i] / count;
+            }
+            double sxy = 0.0;
+            double sxx = 0.0;
+            double syy = 0.0;
+            for (int i = 0; i < count; i++)
+            {
+                sxy += (series[x][i] - xMean) * (series[y][i] - yMean);
+                sxx += (series[x][i] - xMean) * (series[x][i] - xMean);
+                syy += (series[y][i] - yMean) * (series[y][i] - yMean);
+            }
+            double expected = sxy / std::sqrt(sxx * syy);
+            if (std::fabs(expected - correlation.Coefficient(x, y)) > 1e-9)
+                allMatch = false;
+        }
+    }
+    std::cout << "Coefficient(0, 1): " << correlation.Coefficient(0, 1) << std::endl;
+    std::cout << "All pairs match: " << (allMatch ? "Yes" : "No") << std::endl;
+}
+
+void TestMerge()
+{
+    std::cout << "-- Testing Merge() --\n";
+    Correlation all;
+    Correlation parts[3];
+    for (int i = 0; i < 900; i++)
+    {
+        double x = std::cos(i * 0.05) * 8.0 + 500.0;
+        double y = x * 0.3 + (i % 5);
+        double z = (i % 13) - x * 0.01;
+        all.Add(x, y, z);
+        parts[i / 300].Add(x, y, z);
+    }
+    Correlation merged;
+    merged.Merge(parts[2]);
+    merged.Merge(parts[0]);
+    merged.Merge(parts[1]);
+    bool allMatch = merged.Count() == all.Count();
+    for (int a = 0; a < 3; a++)
+    {
+        for (int b = 0; b < 3; b++)
+        {
+            if (std::fabs(all.Coefficient(a, b) - merged.Coefficient(a, b)) > 1e-12)
+                allMatch = false;
+        }
+    }
+    std::cout << "Count: " << merged.Count() << ", all coefficients match: " << (allMatch ? "Yes" : "No") << std::endl;
+}
+
+int main()
+{
+    TestEmpty();
+    std::cout << std::endl;
+    TestPerfectCorrelation();
+    std::cout << std::endl;
+    TestAgainstTwoPass();
+    std::cout << std::endl;
+    TestMerge();
+
+    return 0;
+}
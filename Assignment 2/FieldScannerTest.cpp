@@ -0,0 +1,83 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+#include "FieldScanner.h"
+
+void TestKernelName();
+void TestFindDelimiters();
+void TestCapacityLimit();
+void TestKernelsAgree();
+
+void TestKernelName()
+{
+    std::cout << "-- Testing KernelName() --\n";
+    std::cout << "Kernel: " << FieldScanner::KernelName() << std::endl;
+}
+
+void TestFindDelimiters()
+{
+    std::cout << "-- Testing FindDelimiters() --\n";
+    std::string line = "1/3/2014 9:00,1,2,3,4,5,6,7,8,9,14,587,1,2,3,4,5,21.4\n";
+    std::uint32_t positions[32];
+    std::size_t count = FieldScanner::FindDelimiters(line.data(), line.size(), positions, 32);
+    std::cout << "Delimiters found: " << count << std::endl;
+    std::cout << "Offsets: ";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::cout << positions[i] << " ";
+    }
+    std::cout << std::endl;
+}
+
+void TestCapacityLimit()
+{
+    std::cout << "-- Testing FindDelimiters() Capacity Limit --\n";
+    std::string line = "a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p,q,r,s,t,u,v,w,x,y,z";
+    std::uint32_t positions[4];
+    std::size_t count = FieldScanner::FindDelimiters(line.data(), line.size(), positions, 4);
+    std::cout << "Delimiters found: " << count << " (expected 4)" << std::endl;
+    std::cout << "Last offset: " << positions[count - 1] << " (expected 7)" << std::endl;
+}
+
+void TestKernelsAgree()
+{
+    std::cout << "-- Testing Vector Kernel Against Scalar Kernel --\n";
+    const char alphabet[] = "0123456789./: ,\n";
+    std::srand(7);
+
+    bool agree = true;
+    for (int trial = 0; trial < 200 && agree; ++trial)
+    {
+        std::string block(std::rand() % 300, ' ');
+        for (std::size_t i = 0; i < block.size(); ++i)
+        {
+            block[i] = alphabet[std::rand() % (sizeof(alphabet) - 1)];
+        }
+
+        std::uint32_t fast[400];
+        std::uint32_t slow[400];
+        std::size_t fastCount = FieldScanner::FindDelimiters(block.data(), block.size(), fast, 400);
+        std::size_t slowCount = FieldScanner::FindDelimitersScalar(block.data(), block.size(), slow, 400);
+
+        agree = fastCount == slowCount;
+        for (std::size_t i = 0; i < fastCount && agree; ++i)
+        {
+            agree = fast[i] == slow[i];
+        }
+    }
+    std::cout << "Kernels agree: " << (agree ? "Yes" : "No") << std::endl;
+}
+
+int main()
+{
+    TestKernelName();
+    std::cout << std::endl;
+    TestFindDelimiters();
+    std::cout << std::endl;
+    TestCapacityLimit();
+    std::cout << std::endl;
+    TestKernelsAgree();
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+// FrozenBST.h
+
+/**
+ * @class FrozenBST
+ * @brief An immutable search tree stored as an implicit array in Eytzinger (breadth-first) order.
+ *
+ * The FrozenBST class holds the distinct values of a BST after loading has finished and the tree will no longer
+ * change. It is created by BST::Freeze(). The tree is stored without pointers: the root is at index 1 and the
+ * children of the value at index k are at indices 2k and 2k + 1, so the whole tree is one array of keys.
+ *
+ * @details A search walks down from the root with k = 2k + (key[k] < value), which compiles to a conditional move
+ * instead of a branch, so the processor never mispredicts the direction. The first levels are shared by every
+ * search and stay in cache, and the prefetch issued at each step fetches the cache line holding the descendants
+ * four levels further down, so later levels are usually already loaded when the search reaches them.
+ * SearchBatch() runs a group of searches level by level, so the memory accesses of different keys overlap.
+ *
+ * @note T must be default constructible and comparable with operator<. Only the keys are stored, so a frozen
+ * multiset keeps each distinct value once and loses the occurrence counts.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef FROZENBST_H
+#define FROZENBST_H
+
+#include <cstddef>
+#include <vector>
+
+template <typename T>
+class FrozenBST
+{
+public:
+    static const std::size_t BatchSize = 16; ///< Number of keys searched together by SearchBatch().
+
+    /**
+     * @brief Default constructor for the FrozenBST class. Creates an empty tree.
+     */
+    FrozenBST() : m_keys(1)
+    {
+    }
+
+    /**
+     * @brief Builds a tree from values sorted in increasing order without duplicates.
+     * @param sorted The values of the tree.
+     */
+    explicit FrozenBST(const std::vector<T>& sorted) : m_keys(sorted.size() + 1)
+    {
+        std::size_t next = 0;
+        Build(sorted, next, 1);
+    }
+
+    /**
+     * @brief Gets the number of values in the tree.
+     * @return The number of values.
+     */
+    std::size_t Size() const
+    {
+        return m_keys.size() - 1;
+    }
+
+    /**
+     * @brief Checks if a value is in the tree.
+     * @param value The value to search for.
+     * @return True if the value is found, false otherwise.
+     */
+    bool Search(const T& value) const
+    {
+        std::size_t k = LowerBoundIndex(value);
+        return k != 0 && !(value < m_keys[k]);
+    }
+
+    /**
+     * @brief Finds the smallest value not less than a given value.
+     * @param value The value to search for.
+     * @return Pointer to the smallest value not less than value, or nullptr if there is none.
+     */
+    const T* LowerBound(const T& value) const
+    {
+        std::size_t k = LowerBoundIndex(value);
+        return k == 0 ? nullptr : &m_keys[k];
+    }
+
+    /**
+     * @brief Searches for many values at once.
+     * @param values Pointer to the values to search for.
+     * @param count The number of values.
+     * @param found Array receiving, for each value, true if it is in the tree and false otherwise.
+     */
+    void SearchBatch(const T* values, std::size_t count, bool* found) const
+    {
+        std::size_t k[BatchSize];
+        std::size_t n = Size();
+
+        for (std::size_t first = 0; first < count; first += BatchSize)
+        {
+            std::size_t group = count - first < BatchSize ? count - first : BatchSize;
+            for (std::size_t j = 0; j < group; j++)
+                k[j] = 1;
+
+            // Every search of the group descends one level before any of them descends the next.
+            bool descending = n > 0;
+            while (descending)
+            {
+                descending = false;
+                for (std::size_t j = 0; j < group; j++)
+                {
+                    if (k[j] <= n)
+                    {
+                        Prefetch(k[j]);
+                        k[j] = 2 * k[j] + (m_keys[k[j]] < values[first + j]);
+                        descending = true;
+                    }
+                }
+            }
+
+            for (std::size_t j = 0; j < group; j++)
+            {
+                std::size_t index = UndoRightTurns(k[j]);
+                found[first + j] = index != 0 && !(values[first + j] < m_keys[index]);
+            }
+        }
+    }
+
+private:
+    std::vector<T> m_keys; ///< The values in Eytzinger order, starting at index 1.
+
+    /**
+     * @brief Places sorted values into the subtree rooted at an index, in order.
+     * @param sorted The values of the tree.
+     * @param next Index in sorted of the next value to place.
+     * @param k Index of the root of the subtree.
+     */
+    void Build(const std::vector<T>& sorted, std::size_t& next, std::size_t k)
+    {
+        if (k < m_keys.size())
+        {
+            Build(sorted, next, 2 * k);
+            m_keys[k] = sorted[next++];
+            Build(sorted, next, 2 * k + 1);
+        }
+    }
+
+    /**
+     * @brief Finds the index of the smallest value not less than a given value.
+     * @param value The value to search for.
+     * @return The index of that value, or 0 if every value is less than value.
+     */
+    std::size_t LowerBoundIndex(const T& value) const
+    {
+        std::size_t n = Size();
+        std::size_t k = 1;
+        while (k <= n)
+        {
+            Prefetch(k);
+            k = 2 * k + (m_keys[k] < value);
+        }
+        return UndoRightTurns(k);
+    }
+
+    /**
+     * @brief Returns from the leaf reached by a search to the last node where the search turned left.
+     * @param k The index one level below the leaves where the search ended.
+     * @return The index of the last left turn, or 0 if the search only turned right.
+     */
+    static std::size_t UndoRightTurns(std::size_t k)
+    {
+        // The trailing ones of k are the right turns taken after the last left turn.
+#if defined(__GNUC__)
+        return k >> (__builtin_ctzll(~static_cast<unsigned long long>(k)) + 1);
+#else
+        while (k & 1)
+            k >>= 1;
+        return k >> 1;
+#endif
+    }
+
+    /**
+     * @brief Requests the cache line holding the descendants of a node four levels down.
+     * @param k The index of the node.
+     */
+    void Prefetch(std::size_t k) const
+    {
+#if defined(__GNUC__)
+        std::size_t descendant = 16 * k;
+        if (descendant < m_keys.size())
+            __builtin_prefetch(m_keys.data() + descendant);
+#else
+        (void)k;
+#endif
+    }
+};
+
+#endif // FROZENBST_H
@@ -0,0 +1,74 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <memory>
+
+#include "BST.h"
+#include "FrozenBST.h"
+
+template <typename Function>
+double TimeRun(Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void BenchmarkSearch(std::size_t keyCount, std::size_t queryCount)
+{
+    std::cout << "-- " << keyCount << " keys, " << queryCount << " searches --\n";
+    std::mt19937 random(42);
+
+    BST<int> tree;
+    for (std::size_t i = 0; i < keyCount; ++i)
+    {
+        int key = static_cast<int>(2 * i);
+        tree.Insert(key);
+    }
+    FrozenBST<int> frozen = tree.Freeze();
+
+    // Half of the searched keys are in the tree.
+    std::vector<int> queries(queryCount);
+    std::uniform_int_distribution<int> keys(0, static_cast<int>(2 * keyCount));
+    for (int& query : queries)
+        query = keys(random);
+
+    std::size_t treeFound = 0;
+    std::size_t frozenFound = 0;
+    std::size_t batchFound = 0;
+    std::unique_ptr<bool[]> found(new bool[queryCount]);
+
+    double treeTime = TimeRun([&]()
+    {
+        for (int& query : queries)
+            treeFound += tree.Search(query);
+    });
+    double frozenTime = TimeRun([&]()
+    {
+        for (int query : queries)
+            frozenFound += frozen.Search(query);
+    });
+    double batchTime = TimeRun([&]()
+    {
+        frozen.SearchBatch(queries.data(), queries.size(), found.get());
+    });
+    for (std::size_t i = 0; i < queryCount; ++i)
+        batchFound += found[i];
+
+    std::cout << "BST::Search:            " << treeTime << " s (found " << treeFound << ")" << std::endl;
+    std::cout << "FrozenBST::Search:      " << frozenTime << " s (found " << frozenFound << ")" << std::endl;
+    std::cout << "FrozenBST::SearchBatch: " << batchTime << " s (found " << batchFound << ")" << std::endl;
+    std::cout << "Speed-up: " << treeTime / frozenTime << "x single, " << treeTime / batchTime << "x batch" << std::endl;
+    std::cout << "Memory: " << tree.size() * sizeof(node<int>) << " bytes of nodes, " << (frozen.Size() + 1) * sizeof(int)
+              << " bytes of keys" << std::endl;
+}
+
+int main()
+{
+    BenchmarkSearch(1000, 1000000);
+    std::cout << std::endl;
+    BenchmarkSearch(4000000, 1000000);
+
+    return 0;
+}
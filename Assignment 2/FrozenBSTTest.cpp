@@ -0,0 +1,117 @@
+#include <iostream>
+#include <vector>
+#include <memory>
+
+#include "BST.h"
+#include "FrozenBST.h"
+
+void TestEmpty();
+void TestFreeze();
+void TestSearch();
+void TestLowerBound();
+void TestSearchBatch();
+
+void TestEmpty()
+{
+    std::cout << "-- Testing Empty Tree --\n";
+    FrozenBST<int> tree;
+    int value = 5;
+    bool found = true;
+    tree.SearchBatch(&value, 1, &found);
+    std::cout << "Size: " << tree.Size() << std::endl;
+    std::cout << "Search 5: " << (tree.Search(5) ? "Found" : "Not found") << std::endl;
+    std::cout << "SearchBatch 5: " << (found ? "Found" : "Not found") << std::endl;
+    std::cout << "LowerBound 5: " << (tree.LowerBound(5) == nullptr ? "None" : "Some") << std::endl;
+}
+
+void TestFreeze()
+{
+    std::cout << "-- Testing BST::Freeze() --\n";
+    BST<int> tree(true);
+    int values[] = {40, 10, 30, 10, 20, 40, 50};
+    for (int& value : values)
+    {
+        tree.Insert(value);
+    }
+    FrozenBST<int> frozen = tree.Freeze();
+    std::cout << "BST size: " << tree.size() << ", Frozen size: " << frozen.Size() << " (expected 5)" << std::endl;
+}
+
+void TestSearch()
+{
+    std::cout << "-- Testing Search() --\n";
+    std::vector<int> sorted;
+    for (int i = 0; i < 100; i += 2)
+    {
+        sorted.push_back(i);
+    }
+    FrozenBST<int> tree(sorted);
+
+    int mismatches = 0;
+    for (int i = -1; i <= 100; i++)
+    {
+        bool expected = i >= 0 && i < 100 && i % 2 == 0;
+        if (tree.Search(i) != expected)
+            mismatches++;
+    }
+    std::cout << "Search mismatches: " << mismatches << " (expected 0)" << std::endl;
+}
+
+void TestLowerBound()
+{
+    std::cout << "-- Testing LowerBound() --\n";
+    std::vector<float> sorted = {1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f};
+    FrozenBST<float> tree(sorted);
+    float queries[] = {0.0f, 1.5f, 3.0f, 7.5f, 8.0f};
+    for (float query : queries)
+    {
+        const float* bound = tree.LowerBound(query);
+        std::cout << "LowerBound(" << query << "): ";
+        if (bound != nullptr)
+            std::cout << *bound << std::endl;
+        else
+            std::cout << "None" << std::endl;
+    }
+}
+
+void TestSearchBatch()
+{
+    std::cout << "-- Testing SearchBatch() --\n";
+    std::vector<int> sorted;
+    for (int i = 0; i < 1000; i += 3)
+    {
+        sorted.push_back(i);
+    }
+    FrozenBST<int> tree(sorted);
+
+    std::vector<int> queries;
+    for (int i = 0; i < 1000; i++)
+    {
+        queries.push_back((i * 7) % 1000);
+    }
+    std::unique_ptr<bool[]> found(new bool[queries.size()]);
+    tree.SearchBatch(queries.data(), queries.size(), found.get());
+
+    int mismatches = 0;
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        if (found[i] != tree.Search(queries[i]))
+            mismatches++;
+    }
+    std::cout << "SearchBatch mismatches: " << mismatches << " (expected 0)" << std::endl;
+}
+
+int main()
+{
+    TestEmpty();
+    std::cout << std::endl;
+    TestFreeze();
+    std::cout << std::endl;
+    TestSearch();
+    std::cout << std::endl;
+    TestLowerBound();
+    std::cout << std::endl;
+    TestSearchBatch();
+
+    return 0;
+}
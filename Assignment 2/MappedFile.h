@@ -0,0 +1,86 @@
+// MappedFile.h
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The MappedFile class maps a file into the address space of the process so that its bytes can be
+ * parsed in place, without reading them into intermediate std::string buffers.
+ *
+ * @details The mapping is created by Open() and released by Close() or the destructor. While the file
+ * is open, Data() points to Size() contiguous bytes holding the file contents. The bytes are not
+ * null-terminated, so callers must always work with the (Data(), Size()) range. On POSIX systems the
+ * mapping uses mmap(), on Windows it uses CreateFileMapping()/MapViewOfFile().
+ *
+ * @note A MappedFile cannot be copied, as it owns the operating system handles of the mapping.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+class MappedFile
+{
+public:
+    /**
+     * @brief Default constructor for the MappedFile class.
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor for the MappedFile class. Releases the mapping if one is open.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps the given file into memory, closing any previously open mapping.
+     * @param path The path of the file to be mapped.
+     * @return True if the file was mapped successfully, false otherwise.
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Releases the current mapping.
+     */
+    void Close();
+
+    /**
+     * @brief Checks if a file is currently mapped.
+     * @return True if a file is mapped, false otherwise.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Gets a pointer to the first byte of the mapped file.
+     * @return Pointer to the mapped bytes, or nullptr if the file is empty or not open.
+     */
+    const char* Data() const;
+
+    /**
+     * @brief Gets the number of mapped bytes.
+     * @return The size of the mapped file in bytes.
+     */
+    std::size_t Size() const;
+
+private:
+    const char* m_data; ///< First byte of the mapping.
+    std::size_t m_size; ///< Size of the mapping in bytes.
+    bool m_open; ///< True while a file is mapped.
+#ifdef _WIN32
+    void* m_file; ///< Win32 file handle.
+    void* m_mapping; ///< Win32 file mapping handle.
+#endif
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,198 @@
+// NodePool.h
+
+/**
+ * @class NodePool
+ * @brief Hands out storage for tree nodes from contiguous slabs.
+ *
+ * The NodePool class is the default node allocator of BST. Instead of one heap allocation per node, it carves
+ * nodes out of large slabs, so building a tree costs a handful of allocations, the nodes of a tree sit close
+ * together in memory, and the whole tree is released at once by Clear().
+ *
+ * @details Slabs start small and double in size up to MaxSlabSize objects, so small trees stay cheap and large
+ * trees need few slabs. Allocate() bumps a pointer through the current slab. Deallocate() puts an object on a free
+ * list that Allocate() serves first. Clear() releases every slab, which costs one deallocation per slab regardless
+ * of the number of objects.
+ *
+ * Any class with the same Allocate(), Deallocate() and Clear() members can be used as the node allocator of a BST.
+ *
+ * @note The pool only provides storage: objects are constructed with placement new and must be destroyed by the
+ * caller before Deallocate() or Clear() if their destructor matters. A NodePool cannot be copied, but moving it
+ * hands its slabs, and every object in them, to the new pool.
+ *
+ * @author Mohsin Ali Khan
+ * @version 02
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+template <typename T>
+class NodePool
+{
+public:
+    static const std::size_t FirstSlabSize = 16; ///< Number of objects in the first slab.
+    static const std::size_t MaxSlabSize = 4096; ///< Largest number of objects in one slab.
+
+    /**
+     * @brief Default constructor for the NodePool class. No storage is allocated until the first Allocate().
+     */
+    NodePool() : m_next(nullptr), m_end(nullptr), m_free(nullptr), m_nextSlabSize(FirstSlabSize), m_allocated(0)
+    {
+    }
+
+    /**
+     * @brief Destructor for the NodePool class. Releases every slab.
+     */
+    ~NodePool()
+    {
+        Clear();
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * @brief Move constructor for the NodePool class.
+     * @param other The pool whose slabs are taken over. It is left empty.
+     */
+    NodePool(NodePool&& other) noexcept
+        : m_slabs(std::move(other.m_slabs)), m_next(other.m_next), m_end(other.m_end), m_free(other.m_free),
+          m_nextSlabSize(other.m_nextSlabSize), m_allocated(other.m_allocated)
+    {
+        other.Reset();
+    }
+
+    /**
+     * @brief Move assignment operator for the NodePool class. Releases the slabs of this pool first.
+     * @param other The pool whose slabs are taken over. It is left empty.
+     * @return Reference to this pool.
+     */
+    NodePool& operator=(NodePool&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            m_slabs.swap(other.m_slabs);
+            m_next = other.m_next;
+            m_end = other.m_end;
+            m_free = other.m_free;
+            m_nextSlabSize = other.m_nextSlabSize;
+            m_allocated = other.m_allocated;
+            other.Reset();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Gets uninitialised storage for one object.
+     * @return Pointer to storage suitably sized and aligned for a T.
+     */
+    T* Allocate()
+    {
+        m_allocated++;
+        if (m_free != nullptr)
+        {
+            Storage* object = m_free;
+            m_free = object->next;
+            return reinterpret_cast<T*>(object);
+        }
+
+        if (m_next == m_end)
+            AddSlab();
+        return reinterpret_cast<T*>(m_next++);
+    }
+
+    /**
+     * @brief Returns the storage of one object to the pool for reuse.
+     * @param object Pointer previously returned by Allocate(), whose object has already been destroyed.
+     */
+    void Deallocate(T* object)
+    {
+        Storage* freed = reinterpret_cast<Storage*>(object);
+        freed->next = m_free;
+        m_free = freed;
+        m_allocated--;
+    }
+
+    /**
+     * @brief Releases every slab, invalidating all storage handed out by the pool.
+     */
+    void Clear()
+    {
+        for (Storage* slab : m_slabs)
+        {
+            delete[] slab;
+        }
+        Reset();
+    }
+
+    /**
+     * @brief Gets the number of objects currently handed out.
+     * @return The number of Allocate() calls not matched by Deallocate() since the last Clear().
+     */
+    std::size_t Allocated() const
+    {
+        return m_allocated;
+    }
+
+    /**
+     * @brief Gets the number of slabs currently held.
+     * @return The number of slabs.
+     */
+    std::size_t SlabCount() const
+    {
+        return m_slabs.size();
+    }
+
+private:
+    /**
+     * @brief Raw storage for one object, also used to link deallocated objects together.
+     */
+    union Storage
+    {
+        Storage* next; ///< Next free object, while the storage is on the free list.
+        alignas(T) unsigned char bytes[sizeof(T)]; ///< Storage of the object, while it is handed out.
+    };
+
+    std::vector<Storage*> m_slabs; ///< Every slab allocated since the last Clear().
+    Storage* m_next; ///< Next unused object of the current slab.
+    Storage* m_end; ///< One past the last object of the current slab.
+    Storage* m_free; ///< Most recently deallocated object.
+    std::size_t m_nextSlabSize; ///< Number of objects in the next slab.
+    std::size_t m_allocated; ///< Number of objects currently handed out.
+
+    /**
+     * @brief Forgets every slab without releasing it, leaving the pool empty.
+     */
+    void Reset()
+    {
+        m_slabs.clear();
+        m_next = m_end = nullptr;
+        m_free = nullptr;
+        m_nextSlabSize = FirstSlabSize;
+        m_allocated = 0;
+    }
+
+    /**
+     * @brief Allocates a new slab and makes it the current slab.
+     */
+    void AddSlab()
+    {
+        Storage* slab = new Storage[m_nextSlabSize];
+        m_slabs.push_back(slab);
+        m_next = slab;
+        m_end = slab + m_nextSlabSize;
+        if (m_nextSlabSize < MaxSlabSize)
+            m_nextSlabSize *= 2;
+    }
+};
+
+#endif // NODEPOOL_H
@@ -0,0 +1,75 @@
+#include <iostream>
+
+#include "NodePool.h"
+
+void TestAllocate();
+void TestDeallocateReuses();
+void TestSlabGrowth();
+void TestClear();
+
+struct Item
+{
+    int value;
+    Item* link;
+};
+
+void TestAllocate()
+{
+    std::cout << "-- Testing Allocate() --\n";
+    NodePool<Item> pool;
+    std::cout << "Slabs before: " << pool.SlabCount() << std::endl;
+    Item* first = new (pool.Allocate()) Item{1, nullptr};
+    Item* second = new (pool.Allocate()) Item{2, first};
+    std::cout << "Values: " << first->value << " " << second->value << " " << second->link->value << std::endl;
+    std::cout << "Adjacent: " << (second == first + 1 ? "Yes" : "No") << std::endl;
+    std::cout << "Allocated: " << pool.Allocated() << ", Slabs: " << pool.SlabCount() << std::endl;
+}
+
+void TestDeallocateReuses()
+{
+    std::cout << "-- Testing Deallocate() --\n";
+    NodePool<Item> pool;
+    Item* first = pool.Allocate();
+    pool.Allocate();
+    pool.Deallocate(first);
+    std::cout << "Allocated after Deallocate(): " << pool.Allocated() << std::endl;
+    std::cout << "Storage reused: " << (pool.Allocate() == first ? "Yes" : "No") << std::endl;
+}
+
+void TestSlabGrowth()
+{
+    std::cout << "-- Testing Slab Growth --\n";
+    NodePool<Item> pool;
+    for (int i = 0; i < 100000; i++)
+    {
+        pool.Allocate();
+    }
+    std::cout << "Allocated: " << pool.Allocated() << ", Slabs: " << pool.SlabCount() << std::endl;
+}
+
+void TestClear()
+{
+    std::cout << "-- Testing Clear() --\n";
+    NodePool<Item> pool;
+    for (int i = 0; i < 1000; i++)
+    {
+        pool.Allocate();
+    }
+    pool.Clear();
+    std::cout << "Allocated: " << pool.Allocated() << ", Slabs: " << pool.SlabCount() << std::endl;
+    new (pool.Allocate()) Item{7, nullptr};
+    std::cout << "Allocated after reuse: " << pool.Allocated() << ", Slabs: " << pool.SlabCount() << std::endl;
+}
+
+int main()
+{
+    TestAllocate();
+    std::cout << std::endl;
+    TestDeallocateReuses();
+    std::cout << std::endl;
+    TestSlabGrowth();
+    std::cout << std::endl;
+    TestClear();
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "NumberParser.h"
+
+#include <charconv>
+
+namespace
+{
+    std::string_view TrimBlanks(std::string_view text)
+    {
+        const char* blanks = " \t\r\n";
+        std::size_t first = text.find_first_not_of(blanks);
+        if (first == std::string_view::npos)
+            return std::string_view();
+
+        std::size_t last = text.find_last_not_of(blanks);
+        return text.substr(first, last - first + 1);
+    }
+
+    template <typename Number>
+    NumberParser::Result Convert(std::string_view text, Number& value)
+    {
+        value = 0;
+        text = TrimBlanks(text);
+        if (text.empty())
+            return NumberParser::Result::Empty;
+
+        // std::from_chars accepts a leading '-' but not a leading '+'.
+        if (text.front() == '+')
+            text.remove_prefix(1);
+
+        const char* first = text.data();
+        const char* last = first + text.size();
+        Number converted;
+        std::from_chars_result result = std::from_chars(first, last, converted);
+        if (result.ec == std::errc::result_out_of_range)
+            return NumberParser::Result::OutOfRange;
+        if (result.ec != std::errc() || result.ptr != last)
+            return NumberParser::Result::Malformed;
+
+        value = converted;
+        return NumberParser::Result::Ok;
+    }
+}
+
+NumberParser::Result NumberParser::ToInt(std::string_view text, int& value)
+{
+    return Convert(text, value);
+}
+
+NumberParser::Result NumberParser::ToUnsigned(std::string_view text, unsigned int& value)
+{
+    return Convert(text, value);
+}
+
+NumberParser::Result NumberParser::ToFloat(std::string_view text, float& value)
+{
+    return Convert(text, value);
+}
+
+const char* NumberParser::ResultToString(Result result)
+{
+    switch (result)
+    {
+    case Result::Ok:
+        return "Ok";
+    case Result::Empty:
+        return "Empty";
+    case Result::Malformed:
+        return "Malformed";
+    case Result::OutOfRange:
+        return "OutOfRange";
+    }
+    return "Null";
+}
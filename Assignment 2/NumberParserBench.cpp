@@ -0,0 +1,107 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+
+#include "NumberParser.h"
+
+// Conversions as they were done by Parse before NumberParser, kept here as the baseline.
+int StreamToInt(std::string line)
+{
+    int i = 0;
+    std::stringstream ss(line);
+    ss >> i;
+    return i;
+}
+
+float StreamToFloat(std::string line)
+{
+    float f = 0.0f;
+    std::stringstream ss(line);
+    ss >> f;
+    return f;
+}
+
+template <typename Function>
+double TimeRun(Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void BenchmarkIntegers(const std::vector<std::string>& fields)
+{
+    std::cout << "-- Integer fields: " << fields.size() << " --\n";
+    long long streamSum = 0;
+    long long parserSum = 0;
+
+    double streamTime = TimeRun([&]()
+    {
+        for (const std::string& field : fields)
+            streamSum += StreamToInt(field);
+    });
+    double parserTime = TimeRun([&]()
+    {
+        for (const std::string& field : fields)
+        {
+            int value;
+            NumberParser::ToInt(field, value);
+            parserSum += value;
+        }
+    });
+
+    std::cout << "stringstream: " << streamTime << " s (checksum " << streamSum << ")" << std::endl;
+    std::cout << "NumberParser: " << parserTime << " s (checksum " << parserSum << ")" << std::endl;
+    std::cout << "Speed-up: " << streamTime / parserTime << "x" << std::endl;
+}
+
+void BenchmarkFloats(const std::vector<std::string>& fields)
+{
+    std::cout << "-- Floating-point fields: " << fields.size() << " --\n";
+    double streamSum = 0.0;
+    double parserSum = 0.0;
+
+    double streamTime = TimeRun([&]()
+    {
+        for (const std::string& field : fields)
+            streamSum += StreamToFloat(field);
+    });
+    double parserTime = TimeRun([&]()
+    {
+        for (const std::string& field : fields)
+        {
+            float value;
+            NumberParser::ToFloat(field, value);
+            parserSum += value;
+        }
+    });
+
+    std::cout << "stringstream: " << streamTime << " s (checksum " << streamSum << ")" << std::endl;
+    std::cout << "NumberParser: " << parserTime << " s (checksum " << parserSum << ")" << std::endl;
+    std::cout << "Speed-up: " << streamTime / parserTime << "x" << std::endl;
+}
+
+int main()
+{
+    const std::size_t FieldCount = 1000000;
+    std::srand(42);
+
+    std::vector<std::string> integers;
+    std::vector<std::string> floats;
+    integers.reserve(FieldCount);
+    floats.reserve(FieldCount);
+    for (std::size_t i = 0; i < FieldCount; ++i)
+    {
+        integers.push_back(std::to_string(std::rand() % 100));
+        floats.push_back(std::to_string(std::rand() % 400 - 50) + "." + std::to_string(std::rand() % 10));
+    }
+
+    BenchmarkIntegers(integers);
+    std::cout << std::endl;
+    BenchmarkFloats(floats);
+
+    return 0;
+}
@@ -1,6 +1,30 @@
 #include "Parse.h"
+#include "FieldScanner.h"
 
-Parse::Parse() : day(0), month(0), year(0), hour(0), minutes(0), windS(0), solarR(0), ambientT(0), logMap()
+#include <cstdint>
+#include <algorithm>
+
+namespace
+{
+    // Returns the field at index of a line whose delimiter offsets were found by FieldScanner.
+    std::string_view FieldAt(std::string_view line, const std::uint32_t* delimiters, std::size_t count, std::size_t index)
+    {
+        std::size_t begin = index == 0 ? 0 : delimiters[index - 1] + 1;
+        std::size_t end = index < count ? delimiters[index] : line.size();
+        return line.substr(begin, end - begin);
+    }
+
+    // Returns the text up to the next delimiter and advances rest past it.
+    std::string_view NextField(std::string_view& rest, char delimiter)
+    {
+        std::size_t pos = rest.find(delimiter);
+        std::string_view field = rest.substr(0, pos);
+        rest.remove_prefix(pos == std::string_view::npos ? rest.size() : pos + 1);
+        return field;
+    }
+}
+
+Parse::Parse() : day(0), month(0), year(0), hour(0), minutes(0), windS(0), solarR(0), ambientT(0), invalidFields(0), plan()
 {
     day = 0;
     month = 0;
@@ -10,82 +34,111 @@ Parse::Parse() : day(0), month(0), year(0), hour(0), minutes(0), windS(0), solar
     windS = 0;
     solarR = 0;
     ambientT = 0;
+    invalidFields = 0;
 }
 
 Parse::~Parse()
 {
 }
 
-void Parse::ParseLog(std::string line)
+std::string_view Parse::ReadHeader(std::string_view bytes, ColumnPlan& plan)
 {
-    logMap.clear();
-    std::stringstream ss(line);
-    std::string d, t, skip, wS, sR, aT;
-    getline(ss, d, ' ');
-    ParseDate(d);
-    getline(ss, t, ',');
-    ParseTime(t);
-    for (int i = 0; i < 9; i++)
-    {
-        getline(ss, skip, ',');
-    }
-    getline(ss, wS, ',');
-    windS = StringToInt(wS);
-    getline(ss, sR, ',');
-    solarR = StringToFloat(sR);
-    for (int i = 0; i < 5; i++)
+    std::size_t headerEnd = bytes.find('\n');
+    if (plan.Compile(bytes.substr(0, headerEnd)))
+        bytes.remove_prefix(headerEnd == std::string_view::npos ? bytes.size() : headerEnd + 1);
+
+    return bytes;
+}
+
+std::size_t Parse::ParseBuffer(std::string_view bytes, const ColumnPlan& plan, ColumnBatch& batch)
+{
+    Parse parser;
+    parser.SetColumnPlan(plan);
+
+    batch.Reserve(batch.Size() + std::count(bytes.begin(), bytes.end(), '\n') + 1);
+
+    std::size_t rows = 0;
+    while (!bytes.empty())
     {
-        getline(ss, skip, ',');
+        std::string_view line = NextField(bytes, '\n');
+        if (parser.ParseLog(line))
+        {
+            batch.Append(Timestamp::Encode(parser.year, parser.month, parser.day, parser.hour, parser.minutes),
+                         static_cast<float>(parser.windS), parser.solarR, parser.ambientT);
+            batch.invalidValues += parser.invalidFields;
+            rows++;
+        }
     }
-    getline(ss, aT, '\n');
-    ambientT = StringToFloat(aT);
-
 
-    std::string timestamp = std::to_string(year) + std::to_string(month) + std::to_string(day) + std::to_string(hour) + std::to_string(minutes);
+    return rows;
+}
 
-    WeatherLog logObj(Date(day, month, year), Time(hour, minutes), windS, ambientT, solarR);
-    logMap[timestamp] = logObj;
+bool Parse::ParseLog(std::string_view line)
+{
+    if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
+
+    // Delimiters after the last planned column are never needed, so the scan stops there.
+    std::uint32_t delimiters[ColumnPlan::MaxColumns];
+    std::size_t lastColumn = plan.GetLastColumn();
+    std::size_t count = FieldScanner::FindDelimiters(line.data(), line.size(), delimiters, lastColumn + 1);
+    if (count < lastColumn)
+        return false;
+
+    std::string_view time = FieldAt(line, delimiters, count, plan.GetTimestampColumn());
+    std::string_view date = NextField(time, ' ');
+    if (!ParseDate(date) || !ParseTime(time))
+        return false;
+
+    invalidFields = 0;
+    if (StringToInt(FieldAt(line, delimiters, count, plan.GetWindSpeedColumn()), windS) != NumberParser::Result::Ok)
+        invalidFields++;
+    if (StringToFloat(FieldAt(line, delimiters, count, plan.GetSolarRadiationColumn()), solarR) != NumberParser::Result::Ok)
+        invalidFields++;
+    if (StringToFloat(FieldAt(line, delimiters, count, plan.GetTemperatureColumn()), ambientT) != NumberParser::Result::Ok)
+        invalidFields++;
+
+    return true;
+}
 
-    logVector.push_back(logMap[timestamp]);
+void Parse::SetColumnPlan(const ColumnPlan& columnPlan)
+{
+    plan = columnPlan;
 }
 
-void Parse::ParseDate(const std::string& date)
+const ColumnPlan& Parse::GetColumnPlan() const
 {
-    std::string d, m, y;
-    std::stringstream ssdate(date);
-    getline(ssdate, d, '/');
-    day = StringToInt(d);
-    getline(ssdate, m, '/');
-    month = StringToInt(m);
-    getline(ssdate, y, ' ');
-    year = StringToInt(y);
+    return plan;
 }
-void Parse::ParseTime(std::string time)
+
+bool Parse::ParseDate(std::string_view date)
 {
-    std::string h, m;
-    std::stringstream sstime(time);
-    getline(sstime, h, ':');
-    hour = StringToInt(h);
-    getline(sstime, m, ',');
-    minutes = StringToInt(m);
+    bool ok = NumberParser::ToUnsigned(NextField(date, '/'), day) == NumberParser::Result::Ok;
+    ok = NumberParser::ToUnsigned(NextField(date, '/'), month) == NumberParser::Result::Ok && ok;
+    ok = NumberParser::ToUnsigned(date, year) == NumberParser::Result::Ok && ok;
+    return ok;
 }
 
-int Parse::StringToInt(std::string line)
+bool Parse::ParseTime(std::string_view time)
 {
-    int i;
-    std::stringstream ss(line);
-    ss >> i;
+    bool ok = NumberParser::ToUnsigned(NextField(time, ':'), hour) == NumberParser::Result::Ok;
+    ok = NumberParser::ToUnsigned(time, minutes) == NumberParser::Result::Ok && ok;
+    return ok;
+}
 
-    return i;
+NumberParser::Result Parse::StringToInt(std::string_view line, int& value)
+{
+    return NumberParser::ToInt(line, value);
 }
 
-float Parse::StringToFloat(std::string line)
+NumberParser::Result Parse::StringToFloat(std::string_view line, float& value)
 {
-    float f;
-    std::stringstream ss(line);
-    ss >> f;
+    return NumberParser::ToFloat(line, value);
+}
 
-    return f;
+unsigned int Parse::GetInvalidFieldCount() const
+{
+    return invalidFields;
 }
 
 unsigned int Parse::GetParseDay()
@@ -6,17 +6,18 @@
  *
  * The Parse class is responsible for parsing weather log data and extracting
  * relevant information such as date, time, wind speed, solar radiation, and ambient temperature.
- * It provides functions to convert strings to integer and floating-point numbers.
+ * It provides functions to convert strings to integer and floating-point numbers, which are implemented by NumberParser
+ * and report empty or malformed fields instead of returning an undefined value.
  *
- * @note The class assumes that the input data follows a specific format, and deviations from the format may lead to undefined behavior.
+ * @note The columns are located through a ColumnPlan, which defaults to the standard logger layout and can be
+ * compiled from the header line of each file with ReadHeader().
  *
- * @details The Parse class reads and interprets weather log data, which contains information about various weather measurements.
- * It extracts date, time, wind speed, solar radiation, and ambient temperature from the log data and stores them for further processing.
- * The class offers functions to parse the date and time strings, converting them into separate day, month, year, hour, and minute components.
- * It also provides functions to convert strings to integer and floating-point numbers for the wind speed, solar radiation, and ambient temperature.
+ * @details ParseBuffer() is the ingestion path for whole files or byte ranges of them. It parses every line of a
+ * buffer into the parallel arrays of a ColumnBatch in one call, without constructing an object per row. ParseLog()
+ * parses a single line into the parser, whose components are then read back with the getter functions.
  *
  * @author Mohsin Ali Khan
- * @version 04
+ * @version 05
  * @date 26/07/2023
  *
  * @bug No known bugs to the best of my knowledge.
@@ -26,17 +27,12 @@
 #define PARSE_H
 
 #include <string>
-#include <map>
-#include <iostream>
-#include <sstream>
-#include <fstream>
-#include <chrono>
-#include <thread>
-#include <vector>
+#include <string_view>
 #include "Date.h"
 #include "Time.h"
-#include "BST.h"
-#include "WeatherLog.h"
+#include "ColumnPlan.h"
+#include "ColumnBatch.h"
+#include "NumberParser.h"
 
 class Parse
 {
@@ -51,37 +47,81 @@ public:
      */
     ~Parse();
 
+    /**
+     * @brief Compiles the column plan of a buffer from its first line, if that line is a header.
+     * @param bytes The contents of a weather data file.
+     * @param plan Receives the layout named by the header. It is left unchanged if the buffer has no header.
+     * @return The bytes following the header line, or all of bytes if there is no header.
+     */
+    static std::string_view ReadHeader(std::string_view bytes, ColumnPlan& plan);
+
+    /**
+     * @brief Parses every line of a buffer and appends the readings to a batch.
+     * @details The delimiters of each line are located in one vectorised pass by FieldScanner, after which only the
+     * date/time, wind speed, solar radiation and ambient temperature columns named by the plan are read. Fields are
+     * read as views into the buffer. Lines whose date or time cannot be parsed are skipped.
+     * @param bytes The lines to parse, without a header line.
+     * @param plan The column layout of the lines.
+     * @param batch The batch the readings are appended to.
+     * @return The number of readings appended to the batch.
+     */
+    static std::size_t ParseBuffer(std::string_view bytes, const ColumnPlan& plan, ColumnBatch& batch);
+
     /**
      * @brief Parses a single line of weather log data.
-     * @param line The line of weather log data to parse.
+     * @param line The line of weather log data to parse, without its trailing newline.
+     * @return True if the date and time of the line were parsed, false for malformed lines such as the CSV header.
+     */
+    bool ParseLog(std::string_view line);
+
+    /**
+     * @brief Sets the column plan used to locate the fields of each line.
+     * @param columnPlan The plan compiled from the header of the file being parsed.
+     */
+    void SetColumnPlan(const ColumnPlan& columnPlan);
+
+    /**
+     * @brief Gets the column plan used to locate the fields of each line.
+     * @return The current column plan.
      */
-    void ParseLog(std::string line);
+    const ColumnPlan& GetColumnPlan() const;
 
     /**
-     * @brief Parses a date string and sets the date components.
+     * @brief Parses a date string of the form "dd/mm/yyyy" and sets the date components.
      * @param date The date string to be parsed.
+     * @return True if the day, month and year were all valid numbers, false otherwise.
      */
-    void ParseDate(const std::string& date);
+    bool ParseDate(std::string_view date);
 
     /**
-     * @brief Parses a time string and sets the time components.
+     * @brief Parses a time string of the form "hh:mm" and sets the time components.
      * @param time The time string to be parsed.
+     * @return True if the hour and minutes were both valid numbers, false otherwise.
      */
-    void ParseTime(std::string time);
+    bool ParseTime(std::string_view time);
 
     /**
      * @brief Converts a string to an integer.
      * @param line The string to be converted.
-     * @return The integer value of the string.
+     * @param value Receives the integer value of the string, or 0 if the string is empty or malformed.
+     * @return The outcome of the conversion.
      */
-    int StringToInt(std::string line);
+    NumberParser::Result StringToInt(std::string_view line, int& value);
 
     /**
      * @brief Converts a string to a floating-point number.
      * @param line The string to be converted.
-     * @return The floating-point value of the string.
+     * @param value Receives the floating-point value of the string, or 0 if the string is empty or malformed.
+     * @return The outcome of the conversion.
      */
-    float StringToFloat(std::string line);
+    NumberParser::Result StringToFloat(std::string_view line, float& value);
+
+    /**
+     * @brief Gets the number of wind speed, solar radiation and ambient temperature fields of the last parsed
+     * line that were empty or malformed and therefore set to 0.
+     * @return The number of invalid fields in the last parsed line.
+     */
+    unsigned int GetInvalidFieldCount() const;
 
     /**
      * @brief Gets the parsed day value.
@@ -140,9 +180,8 @@ private:
     int windS; ///< Parsed wind speed value.
     float solarR; ///< Parsed solar radiation value.
     float ambientT; ///< Parsed ambient temperature value.
-
-    std::map<std::string, WeatherLog> logMap; ///< Map to store weather log data.
-    std::vector<WeatherLog> logVector; ///< Vector to store weather log data.
+    unsigned int invalidFields; ///< Number of empty or malformed values in the last parsed line.
+    ColumnPlan plan; ///< Column layout of the lines being parsed.
 };
 
 #endif // PARSE_H
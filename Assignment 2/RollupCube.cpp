@@ -0,0 +1,103 @@
+#include "RollupCube.h"
+
+#include <algorithm>
+
+namespace
+{
+    bool EarlierCell(const RollupCube::Cell& a, const RollupCube::Cell& b)
+    {
+        if (a.year != b.year)
+            return a.year < b.year;
+        if (a.month != b.month)
+            return a.month < b.month;
+        return a.day < b.day;
+    }
+}
+
+RollupCube::RollupCube()
+{
+}
+
+void RollupCube::Add(Timestamp timestamp, float windSpeed, float temperature, float solarRadiation)
+{
+    unsigned year = timestamp.GetYear();
+    unsigned month = timestamp.GetMonth();
+    FindOrInsert(m_days, year, month, timestamp.GetDay()).summary.Add(windSpeed, temperature, solarRadiation);
+    FindOrInsert(m_months, year, month, 0).summary.Add(windSpeed, temperature, solarRadiation);
+}
+
+void RollupCube::Clear()
+{
+    m_days.clear();
+    m_months.clear();
+}
+
+Summary RollupCube::Day(unsigned year, unsigned month, unsigned day) const
+{
+    return Find(m_days, year, month, day);
+}
+
+Summary RollupCube::Month(unsigned year, unsigned month) const
+{
+    return Find(m_months, year, month, 0);
+}
+
+Summary RollupCube::Year(unsigned year) const
+{
+    Summary summary;
+    auto found = std::lower_bound(m_months.begin(), m_months.end(), Cell{year, 0, 0, Summary()}, EarlierCell);
+    for (; found != m_months.end() && found->year == year; ++found)
+    {
+        summary.Merge(found->summary);
+    }
+    return summary;
+}
+
+Summary RollupCube::MonthOfEveryYear(unsigned month) const
+{
+    Summary summary;
+    for (const Cell& cell : m_months)
+    {
+        if (cell.month == month)
+            summary.Merge(cell.summary);
+    }
+    return summary;
+}
+
+ColumnSpan<RollupCube::Cell> RollupCube::GetDays() const
+{
+    return ColumnSpan<Cell>(m_days.data(), m_days.size());
+}
+
+ColumnSpan<RollupCube::Cell> RollupCube::GetMonths() const
+{
+    return ColumnSpan<Cell>(m_months.data(), m_months.size());
+}
+
+Summary RollupCube::Find(const std::vector<Cell>& cells, unsigned year, unsigned month, unsigned day)
+{
+    auto found = std::lower_bound(cells.begin(), cells.end(), Cell{year, month, day, Summary()}, EarlierCell);
+    if (found != cells.end() && found->year == year && found->month == month && found->day == day)
+        return found->summary;
+
+    return Summary();
+}
+
+RollupCube::Cell& RollupCube::FindOrInsert(std::vector<Cell>& cells, unsigned year, unsigned month, unsigned day)
+{
+    Cell key{year, month, day, Summary()};
+
+    // Readings usually arrive in date order, so the cell is the last one or a new one after it.
+    if (!cells.empty() && cells.back().year == year && cells.back().month == month && cells.back().day == day)
+        return cells.back();
+    if (cells.empty() || EarlierCell(cells.back(), key))
+    {
+        cells.push_back(key);
+        return cells.back();
+    }
+
+    auto found = std::lower_bound(cells.begin(), cells.end(), key, EarlierCell);
+    if (found == cells.end() || EarlierCell(key, *found))
+        found = cells.insert(found, key);
+    return *found;
+}
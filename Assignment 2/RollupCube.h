@@ -0,0 +1,141 @@
+// RollupCube.h
+
+/**
+ * @class RollupCube
+ * @brief Pre-aggregated summaries of the readings of every day and every month.
+ *
+ * The RollupCube class holds a mergeable Summary of the wind speed, temperature and solar radiation of every
+ * (year, month, day) with readings, and of every (year, month). A query at day, month or year granularity is
+ * answered by merging a handful of cells instead of scanning the readings, so repeated reports do not touch the
+ * raw data.
+ *
+ * @details Add() updates the day and month cells of one reading, so the cube is kept current as readings arrive
+ * instead of being rebuilt. A reading at or after the latest day only touches the last cells, in O(1). An earlier
+ * reading finds its cells with a binary search and may insert new ones. WeatherStore feeds its cube from Append().
+ *
+ * The day and month cells are kept in increasing date order, so a cell is found with a binary search.
+ * Day() and Month() return one cell, Year() merges at most 12 month cells and MonthOfEveryYear() merges one month
+ * cell per loaded year. The summaries are indexed by WeatherStore::CorrelatedColumn. Days, months and years
+ * without readings give an empty Summary.
+ *
+ * @note Every reading added is counted, so a reading that replaces another must not be added on top of it. The
+ * cube is then cleared and the remaining readings added again.
+ *
+ * @author Mohsin Ali Khan
+ * @version 02
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef ROLLUPCUBE_H
+#define ROLLUPCUBE_H
+
+#include <vector>
+#include <cstddef>
+#include "ColumnSpan.h"
+#include "Summary.h"
+#include "Timestamp.h"
+
+class RollupCube
+{
+public:
+    /**
+     * @brief The summary of the readings of one day, or of one month when day is 0.
+     */
+    struct Cell
+    {
+        unsigned year; ///< The year of the readings.
+        unsigned month; ///< The month of the readings (1-12).
+        unsigned day; ///< The day of the readings (1-31), or 0 for a month cell.
+        Summary summary; ///< The summary of the readings.
+    };
+
+    /**
+     * @brief Default constructor for the RollupCube class. Creates a cube without cells.
+     */
+    RollupCube();
+
+    /**
+     * @brief Adds one reading to the cells of its day and month.
+     * @param timestamp The date and time of the reading.
+     * @param windSpeed The wind speed of the reading.
+     * @param temperature The ambient temperature of the reading.
+     * @param solarRadiation The solar radiation of the reading.
+     */
+    void Add(Timestamp timestamp, float windSpeed, float temperature, float solarRadiation);
+
+    /**
+     * @brief Removes every cell.
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the summary of one day.
+     * @param year The year.
+     * @param month The month (1-12).
+     * @param day The day of the month (1-31).
+     * @return The summary of the readings of that day.
+     */
+    Summary Day(unsigned year, unsigned month, unsigned day) const;
+
+    /**
+     * @brief Gets the summary of one month.
+     * @param year The year.
+     * @param month The month (1-12).
+     * @return The summary of the readings of that month.
+     */
+    Summary Month(unsigned year, unsigned month) const;
+
+    /**
+     * @brief Gets the summary of one year by merging its month cells.
+     * @param year The year.
+     * @return The summary of the readings of that year.
+     */
+    Summary Year(unsigned year) const;
+
+    /**
+     * @brief Gets the summary of one month in every year by merging the month cells of each year.
+     * @param month The month (1-12).
+     * @return The summary of the readings of that month in every year.
+     */
+    Summary MonthOfEveryYear(unsigned month) const;
+
+    /**
+     * @brief Gets the day cells.
+     * @return One cell per day holding readings, in increasing date order.
+     */
+    ColumnSpan<Cell> GetDays() const;
+
+    /**
+     * @brief Gets the month cells.
+     * @return One cell per month holding readings, in increasing date order.
+     */
+    ColumnSpan<Cell> GetMonths() const;
+
+private:
+    std::vector<Cell> m_days; ///< Summary of every day holding readings.
+    std::vector<Cell> m_months; ///< Summary of every month holding readings.
+
+    /**
+     * @brief Finds the cell of a date, inserting an empty cell in date order if there is none.
+     * @param cells The cells to search, in increasing date order.
+     * @param year The year of the cell.
+     * @param month The month of the cell.
+     * @param day The day of the cell, 0 for a month cell.
+     * @return The cell of that date.
+     */
+    static Cell& FindOrInsert(std::vector<Cell>& cells, unsigned year, unsigned month, unsigned day);
+
+    /**
+     * @brief Finds the summary of one cell.
+     * @param cells The cells to search, in increasing date order.
+     * @param year The year of the cell.
+     * @param month The month of the cell.
+     * @param day The day of the cell, 0 for a month cell.
+     * @return The summary of the cell, or an empty summary if there is no such cell.
+     */
+    static Summary Find(const std::vector<Cell>& cells, unsigned year, unsigned month, unsigned day);
+};
+
+#endif // ROLLUPCUBE_H
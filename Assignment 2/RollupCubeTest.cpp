@@ -0,0 +1,123 @@
+#include <iostream>
+#include <cmath>
+
+#include "RollupCube.h"
+#include "WeatherStore.h"
+
+void TestEmptyCube();
+void TestDayAndMonthCells();
+void TestYearAndMonthOfEveryYear();
+void TestAddOutOfOrder();
+
+bool Close(double a, double b)
+{
+    return std::fabs(a - b) <= 1e-9 * (1.0 + std::fabs(a) + std::fabs(b));
+}
+
+WeatherStore BuildStore()
+{
+    // Two readings a day, at noon and 18:00, on the first three days of March to May in 2014 and 2015.
+    WeatherStore store;
+    for (unsigned year = 2014; year <= 2015; year++)
+    {
+        for (unsigned month = 3; month <= 5; month++)
+        {
+            for (unsigned day = 1; day <= 3; day++)
+            {
+                float base = static_cast<float>((year - 2014) * 100 + month * 10 + day);
+                store.Append(Timestamp::Encode(year, month, day, 12, 0), base, 2.0f * base, base + 1.0f);
+                store.Append(Timestamp::Encode(year, month, day, 18, 0), base + 2.0f, 0.0f, base - 1.0f);
+            }
+        }
+    }
+    store.Finalize();
+    return store;
+}
+
+void TestEmptyCube()
+{
+    std::cout << "-- Testing an Empty Cube --\n";
+    RollupCube cube;
+    std::cout << "Days: " << cube.GetDays().Size() << ", Months: " << cube.GetMonths().Size() << std::endl;
+    std::cout << "Year(2014) count: " << cube.Year(2014).Count() << std::endl;
+}
+
+void TestDayAndMonthCells()
+{
+    std::cout << "-- Testing Day() and Month() --\n";
+    WeatherStore store = BuildStore();
+    const RollupCube& cube = store.GetRollup();
+    std::cout << "Days: " << cube.GetDays().Size() << ", Months: " << cube.GetMonths().Size() << std::endl;
+
+    Summary day = cube.Day(2014, 4, 2);
+    std::cout << "2 April 2014: " << day.Count() << " readings, mean wind speed " << day.Mean(WeatherStore::WindSpeedSeries)
+              << ", total solar radiation " << day.Sum(WeatherStore::SolarRadiationSeries) << std::endl;
+
+    WeatherStore::Partition partition = store.GetPartition(2015, 5);
+    Summary scanned = store.Summarize(partition.begin, partition.end);
+    Summary month = cube.Month(2015, 5);
+    std::cout << "May 2015 matches a scan: "
+              << (month.Count() == scanned.Count()
+                  && Close(month.Mean(WeatherStore::TemperatureSeries), scanned.Mean(WeatherStore::TemperatureSeries))
+                  && Close(month.SampleVariance(WeatherStore::WindSpeedSeries), scanned.SampleVariance(WeatherStore::WindSpeedSeries))
+                  && month.Max(WeatherStore::SolarRadiationSeries) == scanned.Max(WeatherStore::SolarRadiationSeries) ? "Yes" : "No") << std::endl;
+
+    std::cout << "Missing day count: " << cube.Day(2014, 4, 4).Count() << ", missing month count: " << cube.Month(2014, 6).Count() << std::endl;
+}
+
+void TestYearAndMonthOfEveryYear()
+{
+    std::cout << "-- Testing Year() and MonthOfEveryYear() --\n";
+    WeatherStore store = BuildStore();
+    const RollupCube& cube = store.GetRollup();
+
+    Summary year = cube.Year(2015);
+    Summary scanned = store.Summarize(store.LowerBound(Timestamp::Encode(2015, 1, 1, 0, 0)), store.Size());
+    std::cout << "2015: " << year.Count() << " readings, matches a scan: "
+              << (Close(year.Sum(WeatherStore::WindSpeedSeries), scanned.Sum(WeatherStore::WindSpeedSeries))
+                  && Close(year.SampleStandardDeviation(WeatherStore::TemperatureSeries), scanned.SampleStandardDeviation(WeatherStore::TemperatureSeries)) ? "Yes" : "No") << std::endl;
+
+    Correlation everyMarch = cube.MonthOfEveryYear(3).GetCorrelation();
+    Correlation correlated = store.CorrelateMonth(3);
+    std::cout << "Every March: " << everyMarch.Count() << " readings, S_T matches CorrelateMonth(): "
+              << (Close(everyMarch.Coefficient(WeatherStore::WindSpeedSeries, WeatherStore::TemperatureSeries),
+                        correlated.Coefficient(WeatherStore::WindSpeedSeries, WeatherStore::TemperatureSeries)) ? "Yes" : "No") << std::endl;
+}
+
+void TestAddOutOfOrder()
+{
+    std::cout << "-- Testing Add() Out of Date Order --\n";
+    RollupCube cube;
+    cube.Add(Timestamp::Encode(2015, 6, 10, 9, 0), 4.0f, 20.0f, 100.0f);
+    cube.Add(Timestamp::Encode(2014, 6, 10, 9, 0), 2.0f, 10.0f, 50.0f);
+    cube.Add(Timestamp::Encode(2015, 6, 1, 9, 0), 6.0f, 30.0f, 150.0f);
+    cube.Add(Timestamp::Encode(2015, 6, 10, 15, 0), 8.0f, 40.0f, 200.0f);
+    std::cout << "Days: " << cube.GetDays().Size() << ", Months: " << cube.GetMonths().Size() << std::endl;
+
+    bool ordered = true;
+    ColumnSpan<RollupCube::Cell> days = cube.GetDays();
+    for (std::size_t i = 1; i < days.Size(); i++)
+    {
+        if (days[i - 1].year * 10000 + days[i - 1].month * 100 + days[i - 1].day >= days[i].year * 10000 + days[i].month * 100 + days[i].day)
+            ordered = false;
+    }
+    std::cout << "Days in date order: " << (ordered ? "Yes" : "No") << std::endl;
+    std::cout << "10 June 2015: " << cube.Day(2015, 6, 10).Count() << " readings, June 2015 mean wind speed "
+              << cube.Month(2015, 6).Mean(WeatherStore::WindSpeedSeries) << " (expected 6)" << std::endl;
+
+    cube.Clear();
+    std::cout << "After Clear(), Days: " << cube.GetDays().Size() << ", Months: " << cube.GetMonths().Size() << std::endl;
+}
+
+int main()
+{
+    TestEmptyCube();
+    std::cout << std::endl;
+    TestDayAndMonthCells();
+    std::cout << std::endl;
+    TestYearAndMonthOfEveryYear();
+    std::cout << std::endl;
+    TestAddOutOfOrder();
+
+    return 0;
+}
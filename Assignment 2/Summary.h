@@ -0,0 +1,187 @@
+// Summary.h
+
+/**
+ * @class Summary
+ * @brief Mergeable aggregate of the readings of a window, covering every statistic the reports need.
+ *
+ * The Summary class takes the wind speed, temperature and solar radiation of one reading at a time and keeps
+ * the count of readings and, for each of the three series, its sum, sum of squared deviations, minimum and
+ * maximum, together with the co-moments of every pair of series. The mean, variance, total and correlation of
+ * any window can then be read in O(1).
+ *
+ * @details Merge() is associative and exact: merging the summaries of two disjoint sets of readings gives the
+ * same summary as adding every reading to one, up to rounding. Summaries can therefore be computed per file, per
+ * thread or per month and combined afterwards. The means and co-moments are kept by a Correlation, which applies
+ * Welford's method on Add() and the pairwise update of Chan et al. on Merge(). Sums of squares are kept as sums
+ * of squared deviations from the mean, the form that update merges without cancellation.
+ *
+ * @note The series are indexed like Correlation, 0 to 2, in the order they are passed to Add(). The statistics of
+ * an empty summary are 0.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef SUMMARY_H
+#define SUMMARY_H
+
+#include <cmath>
+#include <cstddef>
+#include "Correlation.h"
+
+class Summary
+{
+public:
+    static const int Series = Correlation::Series; ///< Number of series summarised together.
+
+    /**
+     * @brief Default constructor for the Summary class. Creates the summary of no readings.
+     */
+    Summary() : m_min{0.0, 0.0, 0.0}, m_max{0.0, 0.0, 0.0}
+    {
+    }
+
+    /**
+     * @brief Adds the three values of one reading.
+     * @param first The value of series 0.
+     * @param second The value of series 1.
+     * @param third The value of series 2.
+     */
+    void Add(double first, double second, double third)
+    {
+        double values[Series] = {first, second, third};
+        for (int i = 0; i < Series; i++)
+        {
+            UpdateRange(i, values[i], values[i]);
+        }
+        m_correlation.Add(first, second, third);
+    }
+
+    /**
+     * @brief Adds every reading of another summary.
+     * @param other The summary to be merged into this one.
+     */
+    void Merge(const Summary& other)
+    {
+        if (other.Count() == 0)
+            return;
+
+        for (int i = 0; i < Series; i++)
+        {
+            UpdateRange(i, other.m_min[i], other.m_max[i]);
+        }
+        m_correlation.Merge(other.m_correlation);
+    }
+
+    /**
+     * @brief Gets the number of readings summarised.
+     * @return The count of readings.
+     */
+    std::size_t Count() const
+    {
+        return m_correlation.Count();
+    }
+
+    /**
+     * @brief Gets the sum of one series.
+     * @param series The index of the series (0-2).
+     * @return The sum of the values of the series.
+     */
+    double Sum(int series) const
+    {
+        return m_correlation.Mean(series) * static_cast<double>(Count());
+    }
+
+    /**
+     * @brief Gets the mean of one series.
+     * @param series The index of the series (0-2).
+     * @return The mean of the series.
+     */
+    double Mean(int series) const
+    {
+        return m_correlation.Mean(series);
+    }
+
+    /**
+     * @brief Gets the sum of the squared deviations of one series from its mean.
+     * @param series The index of the series (0-2).
+     * @return The sum of squared deviations of the series.
+     */
+    double SumOfSquaredDeviations(int series) const
+    {
+        return m_correlation.CoMoment(series, series);
+    }
+
+    /**
+     * @brief Gets the sample variance of one series, dividing by the count minus one.
+     * @param series The index of the series (0-2).
+     * @return The sample variance of the series.
+     */
+    double SampleVariance(int series) const
+    {
+        return Count() < 2 ? 0.0 : SumOfSquaredDeviations(series) / static_cast<double>(Count() - 1);
+    }
+
+    /**
+     * @brief Gets the sample standard deviation of one series.
+     * @param series The index of the series (0-2).
+     * @return The square root of the sample variance of the series.
+     */
+    double SampleStandardDeviation(int series) const
+    {
+        return std::sqrt(SampleVariance(series));
+    }
+
+    /**
+     * @brief Gets the smallest value of one series.
+     * @param series The index of the series (0-2).
+     * @return The minimum of the series.
+     */
+    double Min(int series) const
+    {
+        return m_min[series];
+    }
+
+    /**
+     * @brief Gets the largest value of one series.
+     * @param series The index of the series (0-2).
+     * @return The maximum of the series.
+     */
+    double Max(int series) const
+    {
+        return m_max[series];
+    }
+
+    /**
+     * @brief Gets the means and co-moments of the series.
+     * @return The correlation of the readings summarised.
+     */
+    const Correlation& GetCorrelation() const
+    {
+        return m_correlation;
+    }
+
+private:
+    /**
+     * @brief Widens the range of one series. Called before the count includes the new values.
+     * @param series The index of the series (0-2).
+     * @param low The smallest new value.
+     * @param high The largest new value.
+     */
+    void UpdateRange(int series, double low, double high)
+    {
+        if (Count() == 0 || low < m_min[series])
+            m_min[series] = low;
+        if (Count() == 0 || high > m_max[series])
+            m_max[series] = high;
+    }
+
+    Correlation m_correlation; ///< Count, means and co-moments of the series.
+    double m_min[Series]; ///< Smallest value of each series.
+    double m_max[Series]; ///< Largest value of each series.
+};
+
+#endif // SUMMARY_H
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "Summary.h"
+#include "WeatherStore.h"
+
+void TestEmpty();
+void TestAddAndStatistics();
+void TestMergeMatchesSequential();
+void TestParallelReduction();
+void TestSummarize();
+
+bool Close(double a, double b)
+{
+    return std::fabs(a - b) <= 1e-9 * (1.0 + std::fabs(a) + std::fabs(b));
+}
+
+bool SameSummary(const Summary& a, const Summary& b)
+{
+    if (a.Count() != b.Count())
+        return false;
+
+    for (int i = 0; i < Summary::Series; i++)
+    {
+        if (!Close(a.Sum(i), b.Sum(i)) || !Close(a.SampleVariance(i), b.SampleVariance(i))
+            || a.Min(i) != b.Min(i) || a.Max(i) != b.Max(i))
+            return false;
+        for (int j = 0; j < Summary::Series; j++)
+        {
+            if (!Close(a.GetCorrelation().CoMoment(i, j), b.GetCorrelation().CoMoment(i, j)))
+                return false;
+        }
+    }
+    return true;
+}
+
+void AddReading(Summary& summary, int i)
+{
+    summary.Add(10.0 + std::sin(i * 0.3) * 4.0, 15.0 + (i % 24) * 0.5, i % 144 < 72 ? (i % 72) * 10.0 : 0.0);
+}
+
+void TestEmpty()
+{
+    std::cout << "-- Testing Empty Summary --\n";
+    Summary summary;
+    Summary other;
+    other.Add(1.0, -2.0, 3.0);
+    summary.Merge(Summary());
+    std::cout << "Count after merging an empty summary: " << summary.Count() << std::endl;
+    summary.Merge(other);
+    std::cout << "Count after merging one reading: " << summary.Count() << ", Min(1): " << summary.Min(1) << ", Max(1): " << summary.Max(1) << std::endl;
+}
+
+void TestAddAndStatistics()
+{
+    std::cout << "-- Testing Add(), Sum(), Mean(), Min() and Max() --\n";
+    Summary summary;
+    summary.Add(2.0, 10.0, 0.0);
+    summary.Add(4.0, 20.0, 5.0);
+    summary.Add(9.0, 30.0, 1.0);
+    std::cout << "Count: " << summary.Count() << std::endl;
+    std::cout << "Sum(0): " << summary.Sum(0) << ", Mean(1): " << summary.Mean(1) << ", Sample Variance(1): " << summary.SampleVariance(1) << " (expected 100)" << std::endl;
+    std::cout << "Min(2): " << summary.Min(2) << ", Max(2): " << summary.Max(2) << std::endl;
+    std::cout << "Coefficient(0, 1): " << summary.GetCorrelation().Coefficient(0, 1) << std::endl;
+}
+
+void TestMergeMatchesSequential()
+{
+    std::cout << "-- Testing Merge() Against Adding Sequentially --\n";
+    Summary sequential;
+    Summary parts[4];
+    for (int i = 0; i < 1000; i++)
+    {
+        AddReading(sequential, i);
+        // Uneven, interleaved parts, one of them left empty.
+        AddReading(parts[i % 7 == 0 ? 0 : (i < 400 ? 1 : 2)], i);
+    }
+
+    Summary leftToRight;
+    for (const Summary& part : parts)
+    {
+        leftToRight.Merge(part);
+    }
+    Summary rightToLeft = parts[3];
+    rightToLeft.Merge(parts[2]);
+    rightToLeft.Merge(parts[1]);
+    rightToLeft.Merge(parts[0]);
+
+    std::cout << "Left to right matches: " << (SameSummary(sequential, leftToRight) ? "Yes" : "No") << std::endl;
+    std::cout << "Right to left matches: " << (SameSummary(sequential, rightToLeft) ? "Yes" : "No") << std::endl;
+}
+
+void TestParallelReduction()
+{
+    std::cout << "-- Testing a Parallel Reduction --\n";
+    const int readings = 100000;
+    const int threadCount = 4;
+    std::vector<Summary> partials(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&partials, t]()
+        {
+            for (int i = t * readings / threadCount; i < (t + 1) * readings / threadCount; i++)
+            {
+                AddReading(partials[t], i);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    Summary merged;
+    for (const Summary& partial : partials)
+    {
+        merged.Merge(partial);
+    }
+    Summary sequential;
+    for (int i = 0; i < readings; i++)
+    {
+        AddReading(sequential, i);
+    }
+    std::cout << "Count: " << merged.Count() << ", matches sequential: " << (SameSummary(sequential, merged) ? "Yes" : "No") << std::endl;
+}
+
+void TestSummarize()
+{
+    std::cout << "-- Testing WeatherStore::Summarize() --\n";
+    WeatherStore store;
+    for (unsigned day = 1; day <= 20; day++)
+    {
+        store.Append(Timestamp::Encode(2014, 6, day, 12, 0), static_cast<float>(day), 10.0f * day, 30.0f - day);
+    }
+
+    Summary whole = store.Summarize(0, store.Size());
+    Summary merged = store.Summarize(0, 5);
+    merged.Merge(store.Summarize(5, store.Size()));
+    std::cout << "Total solar radiation: " << whole.Sum(WeatherStore::SolarRadiationSeries) << " (expected 2100)" << std::endl;
+    std::cout << "Temperature range: " << whole.Min(WeatherStore::TemperatureSeries) << " to " << whole.Max(WeatherStore::TemperatureSeries) << std::endl;
+    std::cout << "Split summaries match: " << (SameSummary(whole, merged) ? "Yes" : "No") << std::endl;
+}
+
+int main()
+{
+    TestEmpty();
+    std::cout << std::endl;
+    TestAddAndStatistics();
+    std::cout << std::endl;
+    TestMergeMatchesSequential();
+    std::cout << std::endl;
+    TestParallelReduction();
+    std::cout << std::endl;
+    TestSummarize();
+
+    return 0;
+}
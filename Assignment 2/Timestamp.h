@@ -0,0 +1,192 @@
+// Timestamp.h
+
+/**
+ * @class Timestamp
+ * @brief A date and time packed into one 64-bit integer.
+ *
+ * The Timestamp class stores the year, month, day, hour and minute of a reading as bit fields of a single
+ * unsigned 64-bit value. It is used as the key of every timestamp index, so that inserting and looking up a
+ * reading costs integer comparisons instead of building and comparing strings.
+ *
+ * @details From the least significant bit, the value holds the minute (6 bits), hour (5 bits), day (5 bits),
+ * month (4 bits) and year (the remaining 44 bits). Because the more significant fields are stored in the higher
+ * bits, comparing two values gives the same order as comparing the dates and times they encode, and every
+ * distinct date and time has a distinct value. Encoding and decoding are constexpr.
+ *
+ * @note All components are expected to be within their valid ranges. Out of range components are truncated to
+ * the width of their field.
+ *
+ * @author Mohsin Ali Khan
+ * @version 01
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#include <cstdint>
+#include "Date.h"
+#include "Time.h"
+
+class Timestamp
+{
+public:
+    static const unsigned MinuteShift = 0; ///< Position of the minute field.
+    static const unsigned HourShift = 6; ///< Position of the hour field.
+    static const unsigned DayShift = 11; ///< Position of the day field.
+    static const unsigned MonthShift = 16; ///< Position of the month field.
+    static const unsigned YearShift = 20; ///< Position of the year field.
+
+    /**
+     * @brief Default constructor for the Timestamp class. Encodes 00:00 on day 0 of month 0 of year 0.
+     */
+    constexpr Timestamp() : m_value(0)
+    {
+    }
+
+    /**
+     * @brief Constructs a timestamp from its packed value.
+     * @param value A value previously returned by GetValue().
+     */
+    constexpr explicit Timestamp(std::uint64_t value) : m_value(value)
+    {
+    }
+
+    /**
+     * @brief Packs a date and time into a timestamp.
+     * @param year The year.
+     * @param month The month (1-12).
+     * @param day The day of the month (1-31).
+     * @param hour The hour (0-23).
+     * @param minute The minute (0-59).
+     * @return The packed timestamp.
+     */
+    static constexpr Timestamp Encode(unsigned year, unsigned month, unsigned day, unsigned hour, unsigned minute)
+    {
+        return Timestamp((static_cast<std::uint64_t>(year) << YearShift)
+                         | (static_cast<std::uint64_t>(month & 0xF) << MonthShift)
+                         | (static_cast<std::uint64_t>(day & 0x1F) << DayShift)
+                         | (static_cast<std::uint64_t>(hour & 0x1F) << HourShift)
+                         | (static_cast<std::uint64_t>(minute & 0x3F) << MinuteShift));
+    }
+
+    /**
+     * @brief Packs a Date and a Time into a timestamp.
+     * @param date The date to pack.
+     * @param time The time to pack.
+     * @return The packed timestamp.
+     */
+    static Timestamp FromDateTime(const Date& date, const Time& time)
+    {
+        return Encode(date.GetYear(), date.GetMonth(), date.GetDay(), time.GetHours(), time.GetMinutes());
+    }
+
+    /**
+     * @brief Gets the packed value of the timestamp.
+     * @return The packed value.
+     */
+    constexpr std::uint64_t GetValue() const
+    {
+        return m_value;
+    }
+
+    /**
+     * @brief Gets the year of the timestamp.
+     * @return The year.
+     */
+    constexpr unsigned GetYear() const
+    {
+        return static_cast<unsigned>(m_value >> YearShift);
+    }
+
+    /**
+     * @brief Gets the month of the timestamp.
+     * @return The month.
+     */
+    constexpr unsigned GetMonth() const
+    {
+        return static_cast<unsigned>((m_value >> MonthShift) & 0xF);
+    }
+
+    /**
+     * @brief Gets the day of the timestamp.
+     * @return The day of the month.
+     */
+    constexpr unsigned GetDay() const
+    {
+        return static_cast<unsigned>((m_value >> DayShift) & 0x1F);
+    }
+
+    /**
+     * @brief Gets the hour of the timestamp.
+     * @return The hour.
+     */
+    constexpr unsigned GetHour() const
+    {
+        return static_cast<unsigned>((m_value >> HourShift) & 0x1F);
+    }
+
+    /**
+     * @brief Gets the minute of the timestamp.
+     * @return The minute.
+     */
+    constexpr unsigned GetMinute() const
+    {
+        return static_cast<unsigned>((m_value >> MinuteShift) & 0x3F);
+    }
+
+    /**
+     * @brief Decodes the date of the timestamp.
+     * @return The date.
+     */
+    Date GetDate() const
+    {
+        return Date(GetDay(), GetMonth(), GetYear());
+    }
+
+    /**
+     * @brief Decodes the time of the timestamp.
+     * @return The time.
+     */
+    Time GetTime() const
+    {
+        return Time(GetHour(), GetMinute());
+    }
+
+    constexpr bool operator<(const Timestamp& other) const
+    {
+        return m_value < other.m_value;
+    }
+
+    constexpr bool operator>(const Timestamp& other) const
+    {
+        return m_value > other.m_value;
+    }
+
+    constexpr bool operator<=(const Timestamp& other) const
+    {
+        return m_value <= other.m_value;
+    }
+
+    constexpr bool operator>=(const Timestamp& other) const
+    {
+        return m_value >= other.m_value;
+    }
+
+    constexpr bool operator==(const Timestamp& other) const
+    {
+        return m_value == other.m_value;
+    }
+
+    constexpr bool operator!=(const Timestamp& other) const
+    {
+        return m_value != other.m_value;
+    }
+
+private:
+    std::uint64_t m_value; ///< The packed date and time.
+};
+
+#endif // TIMESTAMP_H
@@ -1,11 +1,11 @@
 #include "WeatherLog.h"
 
-WeatherLog::WeatherLog() : m_date(), m_time(), m_speed(0.0f), m_ambientTemperature(0.0f), m_solarRadiation(0.0f)
+WeatherLog::WeatherLog() : m_timestamp(0), m_speed(0.0f), m_ambientTemperature(0.0f), m_solarRadiation(0.0f)
 {
 }
 
 WeatherLog::WeatherLog(const Date& date, const Time& time, int windSpeed, float ambientTemperature, float solarRadiation)
-    : m_date(date), m_time(time), m_speed(windSpeed), m_ambientTemperature(ambientTemperature), m_solarRadiation(solarRadiation)
+    : m_timestamp(static_cast<std::uint32_t>(Timestamp::FromDateTime(date, time).GetValue())), m_speed(windSpeed), m_ambientTemperature(ambientTemperature), m_solarRadiation(solarRadiation)
 {
 }
 
@@ -58,24 +58,24 @@ float WeatherLog::GetSolarRadiation() const
     return m_solarRadiation;
 }
 
-const Date& WeatherLog::GetDate() const
+Date WeatherLog::GetDate() const
 {
-    return m_date;
+    return GetTimestamp().GetDate();
 }
 
-const Time& WeatherLog::GetTime() const
+Time WeatherLog::GetTime() const
 {
-    return m_time;
+    return GetTimestamp().GetTime();
 }
 
-bool WeatherLog::operator<(const WeatherLog& other) const
+Timestamp WeatherLog::GetTimestamp() const
 {
-    if (m_date < other.m_date)
-        return true;
-    if (m_date > other.m_date)
-        return false;
+    return Timestamp(m_timestamp);
+}
 
-    return m_time < other.m_time;
+bool WeatherLog::operator<(const WeatherLog& other) const
+{
+    return m_timestamp < other.m_timestamp;
 }
 
 bool WeatherLog::operator>(const WeatherLog& other) const
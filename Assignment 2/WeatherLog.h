@@ -11,10 +11,14 @@
  * as well as retrieving the date and time of the weather log entry. The class provides overloads for comparison
  * operators to compare weather log entries based on their date and time.
  *
+ * The date and time are stored packed into a single 32-bit value using the Timestamp bit layout, so a record
+ * takes 16 bytes instead of 32 and two records are ordered by one integer comparison. GetDate() and GetTime()
+ * decode the packed value on demand.
+ *
  * @note The class assumes that the input values for wind speed, ambient temperature, and solar radiation are valid.
  *
  * @author Mohsin Ali Khan
- * @version 04
+ * @version 05
  * @date 26/07/2023
  *
  * @bug No known bugs to the best of my knowledge.
@@ -23,10 +27,10 @@
 #ifndef WEATHERLOG_H
 #define WEATHERLOG_H
 
-#include <string>
-#include <map>
+#include <cstdint>
 #include "Date.h"
 #include "Time.h"
+#include "Timestamp.h"
 
 class WeatherLog
 {
@@ -89,13 +93,19 @@ public:
      * @brief Gets the date of the weather log entry.
      * @return The date of the weather log entry.
      */
-    const Date& GetDate() const;
+    Date GetDate() const;
 
     /**
      * @brief Gets the time of the weather log entry.
      * @return The time of the weather log entry.
      */
-    const Time& GetTime() const;
+    Time GetTime() const;
+
+    /**
+     * @brief Gets the packed date and time of the weather log entry.
+     * @return The timestamp of the weather log entry.
+     */
+    Timestamp GetTimestamp() const;
 
     /**
      * @brief Overloaded less-than operator for comparing WeatherLog objects.
@@ -112,8 +122,7 @@ public:
     bool operator>(const WeatherLog& other) const;
 
 private:
-    Date m_date; ///< The date of the weather log entry.
-    Time m_time; ///< The time of the weather log entry.
+    std::uint32_t m_timestamp; ///< The date and time of the weather log entry, packed as by Timestamp.
     float m_speed; ///< The wind speed value of the weather log entry.
     float m_ambientTemperature; ///< The ambient temperature value of the weather log entry.
     float m_solarRadiation; ///< The solar radiation value of the weather log entry.
@@ -0,0 +1,225 @@
+#include "WeatherStore.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+    template <typename T>
+    void Gather(std::vector<T>& column, const std::vector<std::size_t>& order)
+    {
+        std::vector<T> gathered;
+        gathered.reserve(order.size());
+        for (std::size_t index : order)
+        {
+            gathered.push_back(column[index]);
+        }
+        column.swap(gathered);
+    }
+}
+
+WeatherStore::WeatherStore() : m_finalized(true)
+{
+}
+
+void WeatherStore::Append(Timestamp timestamp, float windSpeed, float solarRadiation, float temperature)
+{
+    if (!m_timestamps.empty() && !(m_timestamps.back() < timestamp))
+        m_finalized = false;
+
+    m_timestamps.push_back(timestamp);
+    m_windSpeeds.push_back(windSpeed);
+    m_solarRadiations.push_back(solarRadiation);
+    m_temperatures.push_back(temperature);
+
+    if (m_finalized)
+        ExtendPartitions(m_timestamps.size() - 1);
+}
+
+void WeatherStore::Append(const ColumnBatch& batch)
+{
+    if (batch.Size() == 0)
+        return;
+
+    std::size_t first = m_timestamps.size();
+    if (!m_timestamps.empty() && !(m_timestamps.back() < batch.timestamps.front()))
+        m_finalized = false;
+    for (std::size_t row = 1; row < batch.Size() && m_finalized; row++)
+    {
+        if (!(batch.timestamps[row - 1] < batch.timestamps[row]))
+            m_finalized = false;
+    }
+
+    m_timestamps.insert(m_timestamps.end(), batch.timestamps.begin(), batch.timestamps.end());
+    m_windSpeeds.insert(m_windSpeeds.end(), batch.windSpeeds.begin(), batch.windSpeeds.end());
+    m_solarRadiations.insert(m_solarRadiations.end(), batch.solarRadiations.begin(), batch.solarRadiations.end());
+    m_temperatures.insert(m_temperatures.end(), batch.temperatures.begin(), batch.temperatures.end());
+
+    if (m_finalized)
+        ExtendPartitions(first);
+}
+
+void WeatherStore::Finalize()
+{
+    if (m_finalized)
+        return;
+
+    // A stable sort keeps readings with equal timestamps in the order they were appended.
+    std::vector<std::size_t> order(m_timestamps.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b)
+    {
+        return m_timestamps[a] < m_timestamps[b];
+    });
+
+    std::vector<std::size_t> kept;
+    kept.reserve(order.size());
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+        if (i + 1 == order.size() || m_timestamps[order[i]] != m_timestamps[order[i + 1]])
+            kept.push_back(order[i]);
+    }
+
+    Gather(m_timestamps, kept);
+    Gather(m_windSpeeds, kept);
+    Gather(m_solarRadiations, kept);
+    Gather(m_temperatures, kept);
+    m_finalized = true;
+
+    m_partitions.clear();
+    m_rollup.Clear();
+    ExtendPartitions(0);
+}
+
+bool WeatherStore::IsFinalized() const
+{
+    return m_finalized;
+}
+
+std::size_t WeatherStore::Size() const
+{
+    return m_timestamps.size();
+}
+
+void WeatherStore::Reserve(std::size_t readings)
+{
+    m_timestamps.reserve(readings);
+    m_windSpeeds.reserve(readings);
+    m_solarRadiations.reserve(readings);
+    m_temperatures.reserve(readings);
+}
+
+ColumnSpan<Timestamp> WeatherStore::GetTimestamps() const
+{
+    return ColumnSpan<Timestamp>(m_timestamps.data(), m_timestamps.size());
+}
+
+ColumnSpan<float> WeatherStore::GetWindSpeeds() const
+{
+    return ColumnSpan<float>(m_windSpeeds.data(), m_windSpeeds.size());
+}
+
+ColumnSpan<float> WeatherStore::GetSolarRadiations() const
+{
+    return ColumnSpan<float>(m_solarRadiations.data(), m_solarRadiations.size());
+}
+
+ColumnSpan<float> WeatherStore::GetTemperatures() const
+{
+    return ColumnSpan<float>(m_temperatures.data(), m_temperatures.size());
+}
+
+std::size_t WeatherStore::LowerBound(Timestamp timestamp) const
+{
+    return std::lower_bound(m_timestamps.begin(), m_timestamps.end(), timestamp) - m_timestamps.begin();
+}
+
+ColumnSpan<WeatherStore::Partition> WeatherStore::GetPartitions() const
+{
+    return ColumnSpan<Partition>(m_partitions.data(), m_partitions.size());
+}
+
+WeatherStore::Partition WeatherStore::GetPartition(unsigned year, unsigned month) const
+{
+    auto found = std::lower_bound(m_partitions.begin(), m_partitions.end(), Partition{year, month, 0, 0},
+                                  [](const Partition& a, const Partition& b)
+    {
+        return a.year < b.year || (a.year == b.year && a.month < b.month);
+    });
+
+    if (found != m_partitions.end() && found->year == year && found->month == month)
+        return *found;
+
+    // An empty range placed where the month would be, so callers can still slice the columns with it.
+    std::size_t position = found != m_partitions.end() ? found->begin : m_timestamps.size();
+    return Partition{year, month, position, position};
+}
+
+const RollupCube& WeatherStore::GetRollup() const
+{
+    return m_rollup;
+}
+
+void WeatherStore::ExtendPartitions(std::size_t first)
+{
+    for (std::size_t i = first; i < m_timestamps.size(); i++)
+    {
+        unsigned year = m_timestamps[i].GetYear();
+        unsigned month = m_timestamps[i].GetMonth();
+        if (m_partitions.empty() || m_partitions.back().year != year || m_partitions.back().month != month)
+            m_partitions.push_back(Partition{year, month, i, i});
+        m_partitions.back().end = i + 1;
+        m_rollup.Add(m_timestamps[i], m_windSpeeds[i], m_temperatures[i], m_solarRadiations[i]);
+    }
+}
+
+Correlation WeatherStore::Correlate(std::size_t begin, std::size_t end) const
+{
+    const float* speeds = m_windSpeeds.data();
+    const float* temperatures = m_temperatures.data();
+    const float* solars = m_solarRadiations.data();
+    Correlation correlation;
+    for (std::size_t i = begin; i < end; i++)
+    {
+        correlation.Add(speeds[i], temperatures[i], solars[i]);
+    }
+    return correlation;
+}
+
+Correlation WeatherStore::CorrelateMonth(unsigned month) const
+{
+    // The month may hold readings in every loaded year, so each year's partition of that month is merged in.
+    Correlation correlation;
+    for (const Partition& partition : m_partitions)
+    {
+        if (partition.month == month)
+            correlation.Merge(Correlate(partition.begin, partition.end));
+    }
+    return correlation;
+}
+
+Correlation WeatherStore::CorrelateRange(Timestamp from, Timestamp to) const
+{
+    std::size_t begin = LowerBound(from);
+    std::size_t end = std::max(begin, LowerBound(to));
+    return Correlate(begin, end);
+}
+
+Summary WeatherStore::Summarize(std::size_t begin, std::size_t end) const
+{
+    const float* speeds = m_windSpeeds.data();
+    const float* temperatures = m_temperatures.data();
+    const float* solars = m_solarRadiations.data();
+    Summary summary;
+    for (std::size_t i = begin; i < end; i++)
+    {
+        summary.Add(speeds[i], temperatures[i], solars[i]);
+    }
+    return summary;
+}
+
+WeatherLog WeatherStore::GetLog(std::size_t index) const
+{
+    return WeatherLog(m_timestamps[index].GetDate(), m_timestamps[index].GetTime(), static_cast<int>(m_windSpeeds[index]),
+                      m_temperatures[index], m_solarRadiations[index]);
+}
@@ -0,0 +1,232 @@
+// WeatherStore.h
+
+/**
+ * @class WeatherStore
+ * @brief Stores weather readings as contiguous column arrays ordered by timestamp.
+ *
+ * The WeatherStore class keeps the timestamp, wind speed, solar radiation and ambient temperature of every
+ * reading in separate arrays, so a query that needs one value per reading streams through one contiguous array
+ * instead of visiting a tree node per reading.
+ *
+ * @details Readings are added with Append() in any order. Finalize() sorts them by timestamp and removes
+ * duplicated timestamps, keeping the reading appended last, which matches the behaviour of inserting every
+ * reading into a map. The columns are read through ColumnSpan views, and GetLog() builds a WeatherLog for code
+ * that still needs one.
+ *
+ * While the store is finalized it also keeps a partition index that maps every (year, month) holding readings to
+ * the contiguous range of indices of those readings, so a query for one month reads only that month's readings.
+ * Every reading appended in order is also added to a RollupCube, so the Summary of its day and month, with their
+ * mean, standard deviation and total, is kept up to date in O(1) per reading and read with GetRollup() without
+ * scanning the readings again.
+ *
+ * Correlate(), CorrelateMonth() and CorrelateRange() walk the wind speed, temperature and solar radiation columns
+ * side by side, so the three values of every reading stay paired by timestamp. They give the correlation of all
+ * three pairs of columns in a single O(n) pass over the readings of the window. Summarize() gives a mergeable
+ * Summary of a range of readings, from which partial results over separate ranges can be combined.
+ *
+ * @note Readings appended in increasing timestamp order keep the store finalized, so Finalize() only sorts when
+ * readings arrived out of order. Such a reading may replace an earlier one, so the partition index and the rollup
+ * stop being updated until Finalize() rebuilds them from the sorted readings.
+ *
+ * @author Mohsin Ali Khan
+ * @version 05
+ * @date 26/07/2023
+ *
+ * @bug No known bugs to the best of my knowledge.
+ */
+
+#ifndef WEATHERSTORE_H
+#define WEATHERSTORE_H
+
+#include <vector>
+#include <cstddef>
+#include "Timestamp.h"
+#include "ColumnSpan.h"
+#include "ColumnBatch.h"
+#include "WeatherLog.h"
+#include "Correlation.h"
+#include "Summary.h"
+#include "RollupCube.h"
+
+class WeatherStore
+{
+public:
+    /**
+     * @brief The readings of one month of one year, as a range of indices into the columns.
+     */
+    struct Partition
+    {
+        unsigned year; ///< The year of the readings.
+        unsigned month; ///< The month of the readings (1-12).
+        std::size_t begin; ///< Index of the first reading of the month.
+        std::size_t end; ///< Index one past the last reading of the month.
+
+        /**
+         * @brief Gets the number of readings in the partition.
+         * @return The number of readings.
+         */
+        std::size_t Size() const
+        {
+            return end - begin;
+        }
+    };
+
+    /**
+     * @brief Index of each column in the Correlation and Summary returned by the store.
+     */
+    enum CorrelatedColumn
+    {
+        WindSpeedSeries = 0, ///< Wind speed.
+        TemperatureSeries = 1, ///< Ambient temperature.
+        SolarRadiationSeries = 2 ///< Solar radiation.
+    };
+
+    /**
+     * @brief Default constructor for the WeatherStore class.
+     */
+    WeatherStore();
+
+    /**
+     * @brief Appends a reading to the store.
+     * @param timestamp The date and time of the reading.
+     * @param windSpeed The wind speed of the reading.
+     * @param solarRadiation The solar radiation of the reading.
+     * @param temperature The ambient temperature of the reading.
+     */
+    void Append(Timestamp timestamp, float windSpeed, float solarRadiation, float temperature);
+
+    /**
+     * @brief Appends every reading of a parsed batch to the store.
+     * @param batch The batch to append.
+     */
+    void Append(const ColumnBatch& batch);
+
+    /**
+     * @brief Sorts the readings by timestamp and removes duplicated timestamps, keeping the last appended reading.
+     */
+    void Finalize();
+
+    /**
+     * @brief Checks if the readings are sorted by timestamp without duplicates.
+     * @return True if no reading was appended out of order since the last Finalize(), false otherwise.
+     */
+    bool IsFinalized() const;
+
+    /**
+     * @brief Gets the number of readings in the store.
+     * @return The number of readings.
+     */
+    std::size_t Size() const;
+
+    /**
+     * @brief Reserves room for a number of readings in every column.
+     * @param readings The number of readings to reserve.
+     */
+    void Reserve(std::size_t readings);
+
+    /**
+     * @brief Gets the timestamp column.
+     * @return A view of the timestamps of all readings.
+     */
+    ColumnSpan<Timestamp> GetTimestamps() const;
+
+    /**
+     * @brief Gets the wind speed column.
+     * @return A view of the wind speeds of all readings.
+     */
+    ColumnSpan<float> GetWindSpeeds() const;
+
+    /**
+     * @brief Gets the solar radiation column.
+     * @return A view of the solar radiations of all readings.
+     */
+    ColumnSpan<float> GetSolarRadiations() const;
+
+    /**
+     * @brief Gets the ambient temperature column.
+     * @return A view of the ambient temperatures of all readings.
+     */
+    ColumnSpan<float> GetTemperatures() const;
+
+    /**
+     * @brief Finds the first reading at or after a timestamp. The store must be finalized.
+     * @param timestamp The timestamp to search for.
+     * @return The index of the first reading not earlier than timestamp, or Size() if there is none.
+     */
+    std::size_t LowerBound(Timestamp timestamp) const;
+
+    /**
+     * @brief Gets the partition index. The store must be finalized.
+     * @return One partition per month holding readings, in increasing (year, month) order.
+     */
+    ColumnSpan<Partition> GetPartitions() const;
+
+    /**
+     * @brief Finds the readings of one month. The store must be finalized.
+     * @param year The year to search for.
+     * @param month The month to search for (1-12).
+     * @return The partition of that month, which is empty if the month has no readings.
+     */
+    Partition GetPartition(unsigned year, unsigned month) const;
+
+    /**
+     * @brief Gets the day and month summaries of the readings. The store must be finalized.
+     * @return The rollup of every reading, indexed by CorrelatedColumn.
+     */
+    const RollupCube& GetRollup() const;
+
+    /**
+     * @brief Correlates the wind speed, temperature and solar radiation of a range of readings.
+     * @param begin Index of the first reading.
+     * @param end Index one past the last reading.
+     * @return The correlation of the readings, indexed by CorrelatedColumn.
+     */
+    Correlation Correlate(std::size_t begin, std::size_t end) const;
+
+    /**
+     * @brief Correlates the readings of one month in every year. The store must be finalized.
+     * @param month The month to correlate (1-12).
+     * @return The correlation of the readings, indexed by CorrelatedColumn.
+     */
+    Correlation CorrelateMonth(unsigned month) const;
+
+    /**
+     * @brief Correlates the readings between two timestamps. The store must be finalized.
+     * @param from The timestamp of the first reading included.
+     * @param to The timestamp of the first reading excluded.
+     * @return The correlation of the readings, indexed by CorrelatedColumn.
+     */
+    Correlation CorrelateRange(Timestamp from, Timestamp to) const;
+
+    /**
+     * @brief Summarises the wind speed, temperature and solar radiation of a range of readings.
+     * @param begin Index of the first reading.
+     * @param end Index one past the last reading.
+     * @return The summary of the readings, indexed by CorrelatedColumn.
+     */
+    Summary Summarize(std::size_t begin, std::size_t end) const;
+
+    /**
+     * @brief Builds a WeatherLog from one reading.
+     * @param index The index of the reading.
+     * @return The reading stored at that index.
+     */
+    WeatherLog GetLog(std::size_t index) const;
+
+private:
+    std::vector<Timestamp> m_timestamps; ///< Date and time of each reading.
+    std::vector<float> m_windSpeeds; ///< Wind speed of each reading.
+    std::vector<float> m_solarRadiations; ///< Solar radiation of each reading.
+    std::vector<float> m_temperatures; ///< Ambient temperature of each reading.
+    std::vector<Partition> m_partitions; ///< Range of readings of each (year, month), valid while finalized.
+    RollupCube m_rollup; ///< Summary of the readings of each day and month, valid while finalized.
+    bool m_finalized; ///< True while the readings are sorted by timestamp without duplicates.
+
+    /**
+     * @brief Adds the readings from an index onwards to the partition index and the rollup.
+     * @param first Index of the first reading not yet in the partition index or the rollup.
+     */
+    void ExtendPartitions(std::size_t first);
+};
+
+#endif // WEATHERSTORE_H
@@ -0,0 +1,180 @@
+#include <iostream>
+
+#include "WeatherStore.h"
+
+void TestDefaultConstructor();
+void TestAppendInOrder();
+void TestFinalizeSortsAndDeduplicates();
+void TestLowerBound();
+void TestGetLog();
+void TestPartitions();
+void TestCorrelate();
+void TestRollupOnAppend();
+
+void PrintStore(const WeatherStore& store)
+{
+    ColumnSpan<Timestamp> timestamps = store.GetTimestamps();
+    ColumnSpan<float> speeds = store.GetWindSpeeds();
+    for (std::size_t i = 0; i < store.Size(); ++i)
+    {
+        std::cout << timestamps[i].GetDate().DateToString() << " " << timestamps[i].GetTime().TimeToString()
+                  << " S=" << speeds[i] << std::endl;
+    }
+}
+
+void TestDefaultConstructor()
+{
+    std::cout << "-- Testing Default Constructor --\n";
+    WeatherStore store;
+    std::cout << "Size: " << store.Size() << std::endl;
+    std::cout << "Finalized: " << (store.IsFinalized() ? "Yes" : "No") << std::endl;
+}
+
+void TestAppendInOrder()
+{
+    std::cout << "-- Testing Append() In Order --\n";
+    WeatherStore store;
+    store.Append(Timestamp::Encode(2014, 3, 1, 9, 0), 10.0f, 500.0f, 20.0f);
+    store.Append(Timestamp::Encode(2014, 3, 1, 9, 10), 12.0f, 510.0f, 20.5f);
+    std::cout << "Size: " << store.Size() << std::endl;
+    std::cout << "Finalized: " << (store.IsFinalized() ? "Yes" : "No") << std::endl;
+}
+
+void TestFinalizeSortsAndDeduplicates()
+{
+    std::cout << "-- Testing Finalize() --\n";
+    WeatherStore store;
+    store.Append(Timestamp::Encode(2014, 11, 1, 0, 0), 1.0f, 0.0f, 15.0f);
+    store.Append(Timestamp::Encode(2014, 1, 11, 0, 0), 2.0f, 0.0f, 25.0f);
+    store.Append(Timestamp::Encode(2014, 11, 1, 0, 0), 3.0f, 0.0f, 16.0f);
+    std::cout << "Finalized before: " << (store.IsFinalized() ? "Yes" : "No") << std::endl;
+    store.Finalize();
+    std::cout << "Finalized after: " << (store.IsFinalized() ? "Yes" : "No") << std::endl;
+    std::cout << "Size: " << store.Size() << " (expected 2, the last duplicate kept)" << std::endl;
+    PrintStore(store);
+}
+
+void TestLowerBound()
+{
+    std::cout << "-- Testing LowerBound() --\n";
+    WeatherStore store;
+    for (unsigned int month = 1; month <= 12; ++month)
+    {
+        store.Append(Timestamp::Encode(2014, month, 1, 0, 0), static_cast<float>(month), 0.0f, 0.0f);
+    }
+    std::cout << "First reading of June: " << store.LowerBound(Timestamp::Encode(2014, 6, 0, 0, 0)) << " (expected 5)" << std::endl;
+    std::cout << "First reading of 2015: " << store.LowerBound(Timestamp::Encode(2015, 0, 0, 0, 0)) << " (expected 12)" << std::endl;
+}
+
+void TestGetLog()
+{
+    std::cout << "-- Testing GetLog() --\n";
+    WeatherStore store;
+    store.Append(Timestamp::Encode(2014, 3, 1, 9, 30), 14.0f, 587.0f, 21.4f);
+    WeatherLog log = store.GetLog(0);
+    std::cout << "Date: " << log.GetDate().DateToString() << ", Time: " << log.GetTime().TimeToString() << std::endl;
+    std::cout << "Speed: " << log.GetSpeed() << ", Solar Radiation: " << log.GetSolarRadiation()
+              << ", Ambient Temperature: " << log.GetAmbientTemperature() << std::endl;
+}
+
+void TestPartitions()
+{
+    std::cout << "-- Testing GetPartitions() and GetPartition() --\n";
+    WeatherStore store;
+    store.Append(Timestamp::Encode(2015, 2, 1, 0, 0), 4.0f, 0.0f, 0.0f);
+    store.Append(Timestamp::Encode(2014, 12, 31, 23, 50), 3.0f, 0.0f, 0.0f);
+    store.Append(Timestamp::Encode(2014, 12, 1, 0, 0), 2.0f, 0.0f, 0.0f);
+    store.Append(Timestamp::Encode(2014, 1, 1, 0, 0), 1.0f, 0.0f, 0.0f);
+    store.Finalize();
+
+    for (const WeatherStore::Partition& partition : store.GetPartitions())
+    {
+        std::cout << Date::MonthToString(partition.month) << " " << partition.year << ": [" << partition.begin
+                  << ", " << partition.end << ")" << std::endl;
+    }
+
+    WeatherStore::Partition december = store.GetPartition(2014, 12);
+    std::cout << "December 2014 readings: " << december.Size() << " (expected 2)" << std::endl;
+    WeatherStore::Partition june = store.GetPartition(2014, 6);
+    std::cout << "June 2014 readings: " << june.Size() << " at " << june.begin << " (expected 0 at 1)" << std::endl;
+
+    store.Append(Timestamp::Encode(2015, 2, 2, 0, 0), 5.0f, 0.0f, 0.0f);
+    std::cout << "February 2015 readings after an in-order Append(): " << store.GetPartition(2015, 2).Size()
+              << " (expected 2)" << std::endl;
+}
+
+void TestCorrelate()
+{
+    std::cout << "-- Testing Correlate(), CorrelateMonth() and CorrelateRange() --\n";
+    WeatherStore store;
+    // Speeds rise with the temperatures and fall as the solar radiation rises, pairing each reading by timestamp.
+    for (unsigned day = 1; day <= 10; day++)
+    {
+        float speed = static_cast<float>(day);
+        store.Append(Timestamp::Encode(2014, 3, day, 12, 0), speed, 100.0f - 5.0f * speed, 2.0f * speed + 1.0f);
+        store.Append(Timestamp::Encode(2015, 3, day, 12, 0), speed + 10.0f, 50.0f - 5.0f * speed, 2.0f * speed + 21.0f);
+        store.Append(Timestamp::Encode(2014, 4, day, 12, 0), speed, static_cast<float>(day % 3), 7.0f);
+    }
+    store.Finalize();
+
+    Correlation march = store.CorrelateMonth(3);
+    std::cout << "March readings: " << march.Count() << std::endl;
+    std::cout << "S_T: " << march.Coefficient(WeatherStore::WindSpeedSeries, WeatherStore::TemperatureSeries) << " (expected 1)" << std::endl;
+    std::cout << "S_R: " << march.Coefficient(WeatherStore::WindSpeedSeries, WeatherStore::SolarRadiationSeries) << std::endl;
+
+    Correlation april = store.CorrelateMonth(4);
+    std::cout << "April T_R with a constant temperature: "
+              << april.Coefficient(WeatherStore::TemperatureSeries, WeatherStore::SolarRadiationSeries) << " (expected 0)" << std::endl;
+
+    Correlation range = store.CorrelateRange(Timestamp::Encode(2014, 3, 3, 0, 0), Timestamp::Encode(2014, 3, 8, 0, 0));
+    std::cout << "Readings from 3 to 7 March 2014: " << range.Count() << ", S_R: "
+              << range.Coefficient(WeatherStore::WindSpeedSeries, WeatherStore::SolarRadiationSeries) << " (expected -1)" << std::endl;
+
+    Correlation empty = store.CorrelateRange(Timestamp::Encode(2016, 1, 1, 0, 0), Timestamp::Encode(2015, 1, 1, 0, 0));
+    std::cout << "Readings in a reversed range: " << empty.Count() << std::endl;
+}
+
+void TestRollupOnAppend()
+{
+    std::cout << "-- Testing the Rollup Kept by Append() --\n";
+    WeatherStore store;
+    store.Append(Timestamp::Encode(2015, 6, 1, 9, 0), 10.0f, 300.0f, 20.0f);
+    store.Append(Timestamp::Encode(2015, 6, 1, 9, 10), 14.0f, 500.0f, 22.0f);
+    store.Finalize();
+
+    // A reading appended in order shows up in its month straight away, without Finalize().
+    store.Append(Timestamp::Encode(2015, 6, 2, 9, 0), 18.0f, 700.0f, 24.0f);
+    Summary june = store.GetRollup().Month(2015, 6);
+    std::cout << "June 2015: " << june.Count() << " readings, mean wind speed " << june.Mean(WeatherStore::WindSpeedSeries)
+              << " (expected 14), standard deviation " << june.SampleStandardDeviation(WeatherStore::WindSpeedSeries)
+              << " (expected 4), total solar radiation " << june.Sum(WeatherStore::SolarRadiationSeries) << " (expected 1500)" << std::endl;
+
+    // A reading that replaces another is only counted once Finalize() has removed the one it replaces.
+    store.Append(Timestamp::Encode(2015, 6, 1, 9, 10), 2.0f, 100.0f, 18.0f);
+    store.Finalize();
+    june = store.GetRollup().Month(2015, 6);
+    std::cout << "June 2015 after replacing a reading: " << june.Count() << " readings, mean wind speed "
+              << june.Mean(WeatherStore::WindSpeedSeries) << " (expected 10), total solar radiation "
+              << june.Sum(WeatherStore::SolarRadiationSeries) << " (expected 1100)" << std::endl;
+}
+
+int main()
+{
+    TestDefaultConstructor();
+    std::cout << std::endl;
+    TestAppendInOrder();
+    std::cout << std::endl;
+    TestFinalizeSortsAndDeduplicates();
+    std::cout << std::endl;
+    TestLowerBound();
+    std::cout << std::endl;
+    TestGetLog();
+    std::cout << std::endl;
+    TestPartitions();
+    std::cout << std::endl;
+    TestCorrelate();
+    std::cout << std::endl;
+    TestRollupOnAppend();
+
+    return 0;
+}
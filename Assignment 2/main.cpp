@@ -3,38 +3,49 @@
 #include <string>
 #include <sstream>
 #include <cmath>
-#include <map>
 #include <chrono>
 #include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 #include "WeatherLog.h"
 #include "Parse.h"
 #include "BST.h"
-
-float CalculateAverage(BST<float>& bst);
-float CalculateTotal(BST<float>& bst);
-float CalculateStandardDeviation(BST<float>& values);
-void PrintAverageWindSpeedAndStandardDeviation(const std::map<std::string, WeatherLog>& logs, unsigned int month, unsigned int year);
-void PrintAverageTemperatureAndStandardDeviation(const std::map<std::string, WeatherLog>& logs, unsigned int year);
-void PrintTotalSolarRadiationByYear(const std::map<std::string, WeatherLog>& logs, unsigned int year);
-void WriteDataToFile(const std::map<std::string, WeatherLog>& logs, unsigned int year);
+#include "MappedFile.h"
+#include "Timestamp.h"
+#include "WeatherStore.h"
+#include "RollupCube.h"
+
+void PrintAverageWindSpeedAndStandardDeviation(const WeatherStore& store, const RollupCube& cube, unsigned int month, unsigned int year);
+void PrintAverageTemperatureAndStandardDeviation(const RollupCube& cube, unsigned int year);
+void PrintTotalSolarRadiationByYear(const RollupCube& cube, unsigned int year);
+void WriteDataToFile(const RollupCube& cube, unsigned int year);
 bool ValidateInput(const std::string& input, int& value);
-void ReadDataFiles(std::map<std::string, WeatherLog>& weatherLogs);
-float CalculateSPearsonCorrelationCoefficient(BST<float>& x, BST<float>& y);
-void CalculatePearsonCorrelationCoefficient(const std::map<std::string, WeatherLog>& logs, unsigned int month) ;
+bool ReadManifest(std::vector<std::string>& csvFileNames);
+bool ParseDataFile(const std::string& path, ColumnBatch& batch);
+void ReadDataFiles(WeatherStore& store, unsigned int workerCount);
+void PrintLoadRate(std::size_t rows, std::size_t invalidValues, double seconds);
+void CalculatePearsonCorrelationCoefficient(const RollupCube& cube, unsigned int month) ;
 
 
-int main()
+int main(int argc, char* argv[])
 {
-    std::map<std::string, WeatherLog> weatherLogs;
-    std::vector<WeatherLog> logVector;
-
-    ReadDataFiles(weatherLogs);
+    WeatherStore weatherStore;
 
-    for (auto& logEntry : weatherLogs)
+    // "--workers N" sets how many files are parsed in parallel.
+    unsigned int workerCount = std::thread::hardware_concurrency();
+    int value;
+    if (argc > 2 && std::string(argv[1]) == "--workers" && ValidateInput(argv[2], value) && value > 0)
     {
-        logVector.push_back(logEntry.second);
+        workerCount = static_cast<unsigned int>(value);
     }
+
+    ReadDataFiles(weatherStore, workerCount);
+
+    // The store keeps its rollup current as readings are appended, so the reports never rescan the readings.
+    const RollupCube& rollupCube = weatherStore.GetRollup();
+
     const int ExitOption = 6;
     int selectedOption;
     int selectedYear;
@@ -80,7 +91,7 @@ int main()
                 std::cout << "Invalid year. Please try again." << std::endl;
                 break;
             }
-            PrintAverageWindSpeedAndStandardDeviation(weatherLogs, selectedMonth, selectedYear);
+            PrintAverageWindSpeedAndStandardDeviation(weatherStore, rollupCube, selectedMonth, selectedYear);
             break;
 
         case 2:
@@ -91,7 +102,7 @@ int main()
                 std::cout << "Invalid year. Please try again." << std::endl;
                 break;
             }
-            PrintAverageTemperatureAndStandardDeviation(weatherLogs, selectedYear);
+            PrintAverageTemperatureAndStandardDeviation(rollupCube, selectedYear);
             break;
 
         case 3:
@@ -103,7 +114,7 @@ int main()
                 break;
             }
 
-            CalculatePearsonCorrelationCoefficient(weatherLogs, selectedMonth);
+            CalculatePearsonCorrelationCoefficient(rollupCube, selectedMonth);
             break;
 
         case 4:
@@ -114,7 +125,7 @@ int main()
                 std::cout << "Invalid year. Please try again." << std::endl;
                 break;
             }
-            WriteDataToFile(weatherLogs, selectedYear);
+            WriteDataToFile(rollupCube, selectedYear);
             std::cout << "Data written to file 'WindTempSolar.csv'." << std::endl;
             break;
 
@@ -126,7 +137,7 @@ int main()
                 std::cout << "Invalid year. Please try again." << std::endl;
                 break;
             }
-            PrintTotalSolarRadiationByYear(weatherLogs, selectedYear);
+            PrintTotalSolarRadiationByYear(rollupCube, selectedYear);
             break;
 
         case ExitOption:
@@ -142,147 +153,149 @@ int main()
     return 0;
 }
 
-void ReadDataFiles(std::map<std::string, WeatherLog>& weatherLogs)
+bool ReadManifest(std::vector<std::string>& csvFileNames)
 {
     std::ifstream sourceFile("data/data_source.txt");
     if (!sourceFile)
     {
         std::cout << "Failed to open data_source.txt." << std::endl;
-        return;
+        return false;
     }
 
     std::string csvFileName;
-    int fileCount = 0;
-    int totalFiles = 0;
-
-    std::string line;
     while (std::getline(sourceFile, csvFileName))
     {
-        totalFiles++;
+        if (!csvFileName.empty() && csvFileName.back() == '\r')
+            csvFileName.pop_back();
+        if (!csvFileName.empty())
+            csvFileNames.push_back(csvFileName);
     }
+
     sourceFile.close();
+    return true;
+}
 
-    sourceFile.open("data/data_source.txt");
+bool ParseDataFile(const std::string& path, ColumnBatch& batch)
+{
+    MappedFile csvFile;
+    if (!csvFile.Open(path))
+        return false;
 
-    while (std::getline(sourceFile, csvFileName))
-    {
-        std::ifstream csvFile("data/" + csvFileName);
-        if (!csvFile)
-        {
-            std::cout << "Failed to open data/" << csvFileName << std::endl;
-            continue;
-        }
+    // A header line selects the column layout of the rest of the file, files without one use the standard layout.
+    ColumnPlan plan;
+    std::string_view bytes = Parse::ReadHeader(std::string_view(csvFile.Data(), csvFile.Size()), plan);
+    Parse::ParseBuffer(bytes, plan, batch);
 
-        std::cout << "Loading data from " << csvFileName << " (" << (++fileCount) << "/" << totalFiles << ")" << std::endl;
+    csvFile.Close();
+    return true;
+}
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+void ReadDataFiles(WeatherStore& store, unsigned int workerCount)
+{
+    std::vector<std::string> csvFileNames;
+    if (!ReadManifest(csvFileNames))
+        return;
 
-        std::string line2;
-        while (std::getline(csvFile, line))
+    auto loadStart = std::chrono::steady_clock::now();
+
+    // Each file is parsed into its own partition by whichever worker claims it next.
+    std::vector<ColumnBatch> partitions(csvFileNames.size());
+    std::atomic<std::size_t> nextFile(0);
+    std::atomic<std::size_t> filesDone(0);
+    std::mutex outputMutex;
+
+    auto worker = [&]()
+    {
+        for (std::size_t fileIndex = nextFile++; fileIndex < csvFileNames.size(); fileIndex = nextFile++)
         {
-            Parse parser;
-            parser.ParseLog(line);
-
-            unsigned int day = parser.GetParseDay();
-            unsigned int month = parser.GetParseMonth();
-            unsigned int year = parser.GetParseYear();
-            unsigned int hour = parser.GetParseHour();
-            unsigned int minute = parser.GetParseMinutes();
-            int windSpeed = parser.GetParseWS();
-            float solarRadiation = parser.GetParseSR();
-            float ambientTemperature = parser.GetParseAT();
-
-            std::string timestamp = std::to_string(year) + std::to_string(month) + std::to_string(day) + std::to_string(hour) + std::to_string(minute);
-            Date date(day, month, year);
-            Time time(hour, minute);
-
-            WeatherLog log(date, time, windSpeed, ambientTemperature, solarRadiation);
-            weatherLogs[timestamp] = log;
-        }
+            const std::string& fileName = csvFileNames[fileIndex];
+            bool loaded = ParseDataFile("data/" + fileName, partitions[fileIndex]);
+            std::size_t done = ++filesDone;
 
-        csvFile.close();
-    }
+            std::lock_guard<std::mutex> lock(outputMutex);
+            if (loaded)
+                std::cout << "Loaded data from " << fileName << " (" << done << "/" << csvFileNames.size() << ")" << std::endl;
+            else
+                std::cout << "Failed to open data/" << fileName << std::endl;
+        }
+    };
 
-    std::cout << "Data loading completed!" << std::endl;
-    sourceFile.close();
-}
+    if (workerCount == 0)
+        workerCount = 1;
+    if (workerCount > csvFileNames.size() && !csvFileNames.empty())
+        workerCount = static_cast<unsigned int>(csvFileNames.size());
 
-bool ValidateInput(const std::string& input, int& value)
-{
-    try
+    std::vector<std::thread> workers;
+    for (unsigned int i = 1; i < workerCount; i++)
     {
-        value = std::stoi(input);
-        return true;
+        workers.emplace_back(worker);
     }
-    catch (const std::exception& e)
+    worker();
+    for (std::thread& thread : workers)
     {
-        return false;
+        thread.join();
     }
-}
-float CalculateAverage(BST<float>& bst)
-{
-    if (bst.size() == 0)
-        return 0.0f;
 
-    float sum = 0.0f;
-    bst.InOrder([&sum](float& value)
+    // Partitions are appended in manifest order, so a reading repeated in a later file replaces the earlier one.
+    std::size_t rowCount = 0;
+    std::size_t invalidValueCount = 0;
+    for (const ColumnBatch& batch : partitions)
     {
-        sum += value;
-    });
-
-    return sum / static_cast<float>(bst.size());
-}
-
-float CalculateTotal(BST<float>& bst)
-{
-    float total = 0.0f;
-    bst.InOrder([&total](float& value)
+        rowCount += batch.Size();
+    }
+    store.Reserve(store.Size() + rowCount);
+    for (ColumnBatch& batch : partitions)
     {
-        total += value;
-    });
+        store.Append(batch);
+        invalidValueCount += batch.invalidValues;
+        batch = ColumnBatch();
+    }
+    store.Finalize();
 
-    return total;
+    std::cout << "Data loading completed using " << workerCount << " worker(s)!" << std::endl;
+    PrintLoadRate(rowCount, invalidValueCount, std::chrono::duration<double>(std::chrono::steady_clock::now() - loadStart).count());
 }
 
-float CalculateStandardDeviation(BST<float>& bst)
+void PrintLoadRate(std::size_t rows, std::size_t invalidValues, double seconds)
 {
-    if (bst.size() == 0)
-        return 0.0f;
-
-    float mean = CalculateAverage(bst);
-    float variance = 0.0f;
-    bst.InOrder([&mean, &variance](float& value)
-    {
-        float diff = value - mean;
-        variance += diff * diff;
-    });
+    std::cout << "Parsed " << rows << " rows in " << seconds << " s";
+    if (seconds > 0.0)
+        std::cout << " (" << static_cast<std::size_t>(rows / seconds) << " rows/s)";
+    std::cout << std::endl;
 
-    variance /= static_cast<float>(bst.size());
-    return std::sqrt(variance);
+    if (invalidValues > 0)
+        std::cout << invalidValues << " empty or malformed values were loaded as 0." << std::endl;
 }
 
-void PrintAverageWindSpeedAndStandardDeviation(const std::map<std::string, WeatherLog>& logs, unsigned int month, unsigned int year)
+bool ValidateInput(const std::string& input, int& value)
 {
-    BST<float> windSpeeds;
-
-    for (const auto& logEntry : logs)
+    try
     {
-        const WeatherLog& log = logEntry.second;
-        if (log.GetDate().GetMonth() == month && log.GetDate().GetYear() == year)
-        {
-            float speed = log.GetSpeed();
-            windSpeeds.Insert(speed);
-        }
+        value = std::stoi(input);
+        return true;
     }
+    catch (const std::exception& e)
+    {
+        return false;
+    }
+}
+void PrintAverageWindSpeedAndStandardDeviation(const WeatherStore& store, const RollupCube& cube, unsigned int month, unsigned int year)
+{
+    Summary summary = cube.Month(year, month);
 
-    if (windSpeeds.size() != 0)
+    if (summary.Count() != 0)
     {
-        float averageWindSpeed = CalculateAverage(windSpeeds);
-        float standardDeviation = CalculateStandardDeviation(windSpeeds);
+        // The median and percentile need the order of the readings, which the summaries do not keep.
+        BST<float> windSpeeds(true);
+        WeatherStore::Partition partition = store.GetPartition(year, month);
+        ColumnSpan<float> speeds = store.GetWindSpeeds().Subspan(partition.begin, partition.Size());
+        windSpeeds.Build(speeds.begin(), speeds.end());
 
         std::cout << Date::MonthToString(month) << " " << year << ":" << std::endl;
-        std::cout << "Average Wind Speed: " << averageWindSpeed << " km/h" << std::endl;
-        std::cout << "Sample Standard Deviation: " << standardDeviation << std::endl;
+        std::cout << "Average Wind Speed: " << summary.Mean(WeatherStore::WindSpeedSeries) << " km/h" << std::endl;
+        std::cout << "Sample Standard Deviation: " << summary.SampleStandardDeviation(WeatherStore::WindSpeedSeries) << std::endl;
+        std::cout << "Median Wind Speed: " << windSpeeds.Median() << " km/h" << std::endl;
+        std::cout << "95th Percentile Wind Speed: " << windSpeeds.Percentile(95.0) << " km/h" << std::endl;
     }
     else
     {
@@ -290,33 +303,18 @@ void PrintAverageWindSpeedAndStandardDeviation(const std::map<std::string, Weath
     }
 }
 
-void PrintAverageTemperatureAndStandardDeviation(const std::map<std::string, WeatherLog>& logs, unsigned int year)
+void PrintAverageTemperatureAndStandardDeviation(const RollupCube& cube, unsigned int year)
 {
     for (unsigned int month = 1; month <= 12; month++)
     {
-        BST<float> temperatures;
-        bool hasData = false;
-
-        for (const auto& logEntry : logs)
-        {
-            const WeatherLog& log = logEntry.second;
-            if (log.GetDate().GetYear() == year && log.GetDate().GetMonth() == month)
-            {
-                float temp = log.GetAmbientTemperature();
-                temperatures.Insert(temp);
-                hasData = true;
-            }
-        }
+        Summary summary = cube.Month(year, month);
 
         std::cout << Date::MonthToString(month) << " " << year << ":" << std::endl;
 
-        if (hasData)
+        if (summary.Count() != 0)
         {
-            float averageTemperature = CalculateAverage(temperatures);
-            float standardDeviation = CalculateStandardDeviation(temperatures);
-
-            std::cout << "Average temperature: " << averageTemperature << " degrees Celsius" << std::endl;
-            std::cout << "Standard deviation of temperature: " << standardDeviation << std::endl;
+            std::cout << "Average temperature: " << summary.Mean(WeatherStore::TemperatureSeries) << " degrees Celsius" << std::endl;
+            std::cout << "Standard deviation of temperature: " << summary.SampleStandardDeviation(WeatherStore::TemperatureSeries) << std::endl;
         }
         else
         {
@@ -327,26 +325,16 @@ void PrintAverageTemperatureAndStandardDeviation(const std::map<std::string, Wea
     }
 }
 
-void PrintTotalSolarRadiationByYear(const std::map<std::string, WeatherLog>& logs, unsigned int year)
+void PrintTotalSolarRadiationByYear(const RollupCube& cube, unsigned int year)
 {
-    float solarRadiations[12] = {0.0f};
-
-    for (const auto& logEntry : logs)
-    {
-        const WeatherLog& log = logEntry.second;
-        if (log.GetDate().GetYear() == year)
-        {
-            unsigned int month = log.GetDate().GetMonth();
-            solarRadiations[month - 1] += log.GetSolarRadiation();
-        }
-    }
-
     for (unsigned int month = 1; month <= 12; month++)
     {
+        double solarRadiation = cube.Month(year, month).Sum(WeatherStore::SolarRadiationSeries);
+
         std::cout << Date::MonthToString(month) << ": ";
-        if (solarRadiations[month - 1] > 0.0f)
+        if (solarRadiation > 0.0)
         {
-            float solarRadiationInKWh = solarRadiations[month - 1] / 3.6f;
+            double solarRadiationInKWh = solarRadiation / 3.6;
             std::cout << solarRadiationInKWh << " kWh/m2" << std::endl;
         }
         else
@@ -356,7 +344,7 @@ void PrintTotalSolarRadiationByYear(const std::map<std::string, WeatherLog>& log
     }
 }
 
-void WriteDataToFile(const std::map<std::string, WeatherLog>& logs, unsigned int year)
+void WriteDataToFile(const RollupCube& cube, unsigned int year)
 {
     std::ofstream outputFile("WindTempSolar.csv");
 
@@ -368,36 +356,16 @@ void WriteDataToFile(const std::map<std::string, WeatherLog>& logs, unsigned int
 
         for (unsigned int month = 1; month <= 12; ++month)
         {
-            BST<float> windSpeeds;
-            BST<float> temperatures;
-            BST<float> solarRadiations;
-
-            for (const auto& logEntry : logs)
-            {
-                const WeatherLog& log = logEntry.second;
-                if (log.GetDate().GetYear() == year && log.GetDate().GetMonth() == month)
-                {
-                    float speed = log.GetSpeed();
-                    windSpeeds.Insert(speed);
-
-                    float temp = log.GetAmbientTemperature();
-                    temperatures.Insert(temp);
-
-                    float solar = log.GetSolarRadiation();
-                    solarRadiations.Insert(solar);
-                }
-            }
+            Summary summary = cube.Month(year, month);
 
-            if (windSpeeds.size() != 0 && temperatures.size() != 0 && solarRadiations.size() != 0)
+            if (summary.Count() != 0)
             {
                 hasData = true;
-                float averageWindSpeed = CalculateAverage(windSpeeds);
-                float averageTemperature = CalculateAverage(temperatures);
-                float totalSolarRadiation = CalculateTotal(solarRadiations);
-                float windSpeedStdDev = CalculateStandardDeviation(windSpeeds);
-                float temperatureStdDev = CalculateStandardDeviation(temperatures);
-
-                outputFile << Date::MonthToString(month) << "," << averageWindSpeed << "(" << windSpeedStdDev << ")," << averageTemperature << "(" << temperatureStdDev << ")," << totalSolarRadiation << "\n";
+                outputFile << Date::MonthToString(month) << "," << summary.Mean(WeatherStore::WindSpeedSeries) << "("
+                           << summary.SampleStandardDeviation(WeatherStore::WindSpeedSeries) << "),"
+                           << summary.Mean(WeatherStore::TemperatureSeries) << "("
+                           << summary.SampleStandardDeviation(WeatherStore::TemperatureSeries) << "),"
+                           << summary.Sum(WeatherStore::SolarRadiationSeries) << "\n";
             }
             else
             {
@@ -417,75 +385,17 @@ void WriteDataToFile(const std::map<std::string, WeatherLog>& logs, unsigned int
         std::cout << "Unable to open the file 'WindTempSolar.csv' for writing." << std::endl;
     }
 }
-void CalculatePearsonCorrelationCoefficient(const std::map<std::string, WeatherLog>& logs, unsigned int month)
+void CalculatePearsonCorrelationCoefficient(const RollupCube& cube, unsigned int month)
 {
-    BST<float> windSpeeds;
-    BST<float> temperatures;
-    BST<float> solarRadiations;
-
-    for(const auto& log : logs)
-    {
-        if(log.second.GetDate().GetMonth() == month)
-        {
+    // The cells summarise every reading's three values together, so the pairs stay aligned by timestamp.
+    const Correlation correlation = cube.MonthOfEveryYear(month).GetCorrelation();
 
-            float speed = log.second.GetSpeed();
-            windSpeeds.Insert(speed);
-
-            float temp = log.second.GetAmbientTemperature();
-            temperatures.Insert(temp);
-
-            float solar = log.second.GetSolarRadiation();
-            solarRadiations.Insert(solar);
-        }
-    }
-
-
-    float S_T = CalculateSPearsonCorrelationCoefficient(windSpeeds, temperatures);
-    float S_R = CalculateSPearsonCorrelationCoefficient(windSpeeds, solarRadiations);
-    float T_R = CalculateSPearsonCorrelationCoefficient(temperatures, solarRadiations);
+    double S_T = correlation.Coefficient(WeatherStore::WindSpeedSeries, WeatherStore::TemperatureSeries);
+    double S_R = correlation.Coefficient(WeatherStore::WindSpeedSeries, WeatherStore::SolarRadiationSeries);
+    double T_R = correlation.Coefficient(WeatherStore::TemperatureSeries, WeatherStore::SolarRadiationSeries);
 
     std::cout << "Sample Pearson Correlation Coefficient for " << Date::MonthToString(month) << ":" << std::endl;
     std::cout << "S_T: " << S_T << std::endl;
     std::cout << "S_R: " << S_R << std::endl;
     std::cout << "T_R: " << T_R << std::endl;
 }
-
-float CalculateSPearsonCorrelationCoefficient(BST<float>& x, BST<float>& y)
-{
-
-    float xMean = CalculateAverage(x);
-    float yMean = CalculateAverage(y);
-
-    float sumNumerator = 0.0;
-    float sumXDenominator = 0.0;
-    float sumYDenominator = 0.0;
-
-    x.InOrder([&](float xVal)
-    {
-        float xDiff = xVal - xMean;
-        sumXDenominator += xDiff * xDiff;
-    });
-
-    y.InOrder([&](float yVal)
-    {
-        float yDiff = yVal - yMean;
-        sumYDenominator += yDiff * yDiff;
-    });
-
-    x.InOrder([&](float xVal)
-    {
-        float xDiff = xVal - xMean;
-
-        y.InOrder([&](float yVal)
-        {
-            float yDiff = yVal - yMean;
-            sumNumerator += xDiff * yDiff;
-        });
-    });
-
-    float denominator = sqrt(sumXDenominator) * sqrt(sumYDenominator);
-    if(denominator == 0)
-        return 0;
-
-    return sumNumerator / denominator;
-}